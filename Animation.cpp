@@ -0,0 +1,211 @@
+﻿#include "Animation.hpp"
+
+#if defined(_M_X64) || defined(__SSE2__)
+# include <emmintrin.h>
+#endif
+
+namespace tomolatoon
+{
+	namespace
+	{
+		// 長さ 0 のアニメーションはこの速さで一瞬で終わらせる
+		constexpr double InstantRate = 1e9;
+
+		double ToRate(const Duration& duration)
+		{
+			return duration.count() > 0 ? 1.0 / duration.count() : InstantRate;
+		}
+
+		// このアプリで使っているイージングは関数ポインタ越しに呼ばず、インライン展開させる
+		double Ease(AnimationSystem::EaseFunc easeFunc, double t)
+		{
+			if (easeFunc == Easing::Linear)
+			{
+				return Easing::Linear(t);
+			}
+
+			if (easeFunc == EaseOutQuint)
+			{
+				return EaseOutQuint(t);
+			}
+
+			return easeFunc(t);
+		}
+	} // namespace
+
+	Animation AnimationSystem::add(const Duration& inDuration, const Duration& outDuration, double start, double finish, EaseFunc easeFunc, double init)
+	{
+		const uint32 dense = static_cast<uint32>(m_ratios.size());
+		uint32       index;
+
+		if (m_free)
+		{
+			index = m_free.back();
+			m_free.pop_back();
+			m_slots[index].dense = dense;
+		}
+		else
+		{
+			index = static_cast<uint32>(m_slots.size());
+			m_slots.push_back(Slot{dense, 0});
+		}
+
+		const double ratio = Clamp(init, 0.0, 1.0);
+
+		m_ratios.push_back(ratio);
+		m_rates.push_back(-ToRate(outDuration));
+		m_inRates.push_back(ToRate(inDuration));
+		m_outRates.push_back(ToRate(outDuration));
+		m_eased.push_back(easeFunc(ratio));
+		m_prevEased.push_back(m_eased.back());
+		m_starts.push_back(start);
+		m_finishes.push_back(finish);
+		m_values.push_back(Math::Lerp(start, finish, m_eased.back()));
+		m_deltas.push_back(0.0);
+		m_easeFuncs.push_back(easeFunc);
+		m_owners.push_back(index);
+
+		return Animation{index, m_slots[index].generation};
+	}
+
+	void AnimationSystem::remove(Animation animation)
+	{
+		if (not contains(animation))
+		{
+			return;
+		}
+
+		const size_t i    = dense(animation);
+		const size_t last = m_ratios.size() - 1;
+
+		// 末尾と入れ替えて詰める
+		if (i != last)
+		{
+			m_ratios[i]    = m_ratios[last];
+			m_rates[i]     = m_rates[last];
+			m_inRates[i]   = m_inRates[last];
+			m_outRates[i]  = m_outRates[last];
+			m_eased[i]     = m_eased[last];
+			m_prevEased[i] = m_prevEased[last];
+			m_starts[i]    = m_starts[last];
+			m_finishes[i]  = m_finishes[last];
+			m_values[i]    = m_values[last];
+			m_deltas[i]    = m_deltas[last];
+			m_easeFuncs[i] = m_easeFuncs[last];
+			m_owners[i]    = m_owners[last];
+
+			m_slots[m_owners[i]].dense = static_cast<uint32>(i);
+		}
+
+		m_ratios.pop_back();
+		m_rates.pop_back();
+		m_inRates.pop_back();
+		m_outRates.pop_back();
+		m_eased.pop_back();
+		m_prevEased.pop_back();
+		m_starts.pop_back();
+		m_finishes.pop_back();
+		m_values.pop_back();
+		m_deltas.pop_back();
+		m_easeFuncs.pop_back();
+		m_owners.pop_back();
+
+		++m_slots[animation.index].generation;
+		m_free.push_back(animation.index);
+	}
+
+	void AnimationSystem::setRange(Animation animation, double start, double finish)
+	{
+		const size_t i = dense(animation);
+		m_starts[i]    = start;
+		m_finishes[i]  = finish;
+
+		cache(i);
+	}
+
+	void AnimationSystem::drive(Animation animation, bool in)
+	{
+		const size_t i = dense(animation);
+		m_rates[i]     = in ? m_inRates[i] : -m_outRates[i];
+	}
+
+	void AnimationSystem::jumpToStart(Animation animation)
+	{
+		const size_t i = dense(animation);
+		m_prevEased[i] = m_eased[i];
+		m_ratios[i]    = 0.0;
+		m_eased[i]     = m_easeFuncs[i](0.0);
+
+		cache(i);
+	}
+
+	void AnimationSystem::update(double deltaSec)
+	{
+		const size_t    count     = m_ratios.size();
+		double*         ratios    = m_ratios.data();
+		const double*   rates     = m_rates.data();
+		double*         eased     = m_eased.data();
+		double*         prevEased = m_prevEased.data();
+		double*         values    = m_values.data();
+		double*         deltas    = m_deltas.data();
+		const double*   starts    = m_starts.data();
+		const double*   finishes  = m_finishes.data();
+		const EaseFunc* easeFuncs = m_easeFuncs.data();
+
+		// 進み具合が変わったものだけイージングと value() を計算し直す
+		// 止まっているものは、前回の update か remove・jumpToStart で m_eased が変わっていた時だけ m_prevEased を揃える
+		// 関数ポインタ越しの呼び出しを跨ぐとメンバの配列を毎回読み直すことになるので、配列は先に取り出しておく
+		const auto step = [&](size_t i, double ratio, double next) {
+			if (next != ratio)
+			{
+				const double prev = eased[i];
+				const double ease = Ease(easeFuncs[i], next);
+
+				prevEased[i] = prev;
+				eased[i]     = ease;
+				values[i]    = Math::Lerp(starts[i], finishes[i], ease);
+				deltas[i]    = values[i] - Math::Lerp(starts[i], finishes[i], prev);
+			}
+			else if (prevEased[i] != eased[i])
+			{
+				prevEased[i] = eased[i];
+				deltas[i]    = 0.0;
+			}
+		};
+
+		size_t i = 0;
+
+		// ratio = Clamp(ratio + rate * deltaSec, 0, 1) を2本ずつ
+#if defined(_M_X64) || defined(__SSE2__)
+		{
+			const __m128d delta = _mm_set1_pd(deltaSec);
+			const __m128d zero  = _mm_setzero_pd();
+			const __m128d one   = _mm_set1_pd(1.0);
+
+			for (; i + 2 <= count; i += 2)
+			{
+				const __m128d ratio = _mm_loadu_pd(ratios + i);
+				const __m128d next  = _mm_min_pd(_mm_max_pd(_mm_add_pd(ratio, _mm_mul_pd(_mm_loadu_pd(rates + i), delta)), zero), one);
+
+				_mm_storeu_pd(ratios + i, next);
+
+				step(i, _mm_cvtsd_f64(ratio), _mm_cvtsd_f64(next));
+				step(i + 1, _mm_cvtsd_f64(_mm_unpackhi_pd(ratio, ratio)), _mm_cvtsd_f64(_mm_unpackhi_pd(next, next)));
+			}
+		}
+#endif
+		for (; i < count; ++i)
+		{
+			const double ratio = ratios[i];
+			ratios[i]          = Clamp(ratio + rates[i] * deltaSec, 0.0, 1.0);
+
+			step(i, ratio, ratios[i]);
+		}
+	}
+
+	void AnimationSystem::cache(size_t i) noexcept
+	{
+		m_values[i] = Math::Lerp(m_starts[i], m_finishes[i], m_eased[i]);
+		m_deltas[i] = m_values[i] - Math::Lerp(m_starts[i], m_finishes[i], m_prevEased[i]);
+	}
+} // namespace tomolatoon
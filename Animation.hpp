@@ -0,0 +1,114 @@
+﻿#pragma once
+
+#include <Siv3D.hpp>
+
+namespace tomolatoon
+{
+	// AnimationSystem に登録したアニメーションを指すハンドル
+	struct Animation
+	{
+		bool operator==(const Animation&) const = default;
+
+		uint32 index      = 0;
+		uint32 generation = 0;
+	};
+
+	// s3d::Transition の進み具合を start から finish へ Lerp するアニメーションを纏めて持ち、1回の update で全て進める
+	// 値は種類毎に連続した配列(SoA)に詰めてあり、進める部分は SIMD で数本ずつ計算する
+	// イージングと Lerp は進めた時に1度だけ計算して結果を持っておくので、value() と deltaValue() は読むだけ
+	struct AnimationSystem
+	{
+		using EaseFunc = double (*)(double);
+
+		/// @brief アニメーションを登録する
+		/// @param inDuration  0 から 1 まで進むのにかかる時間
+		/// @param outDuration 1 から 0 まで戻るのにかかる時間
+		/// @param easeFunc    value() や transition() で使うイージング
+		/// @param init        最初の進み具合 [0, 1]
+		Animation add(const Duration& inDuration, const Duration& outDuration, double start, double finish, EaseFunc easeFunc = Easing::Linear, double init = 0.0);
+
+		void remove(Animation animation);
+
+		bool contains(Animation animation) const noexcept
+		{
+			return animation.index < m_slots.size() && m_slots[animation.index].generation == animation.generation;
+		}
+
+		size_t size() const noexcept
+		{
+			return m_ratios.size();
+		}
+
+		void setRange(Animation animation, double start, double finish);
+
+		/// @brief 次の update から in なら 1 へ、そうでなければ 0 へ向けて進める。向きは次に drive するまで変わらない
+		void drive(Animation animation, bool in);
+
+		/// @brief 直ちに 0 に戻す
+		void jumpToStart(Animation animation);
+
+		/// @brief 全てのアニメーションを deltaSec だけ進める
+		void update(double deltaSec);
+
+		bool isFinish(Animation animation) const
+		{
+			return m_ratios[dense(animation)] >= 1.0;
+		}
+
+		bool isStart(Animation animation) const
+		{
+			return m_ratios[dense(animation)] <= 0.0;
+		}
+
+		double value(Animation animation) const
+		{
+			return m_values[dense(animation)];
+		}
+
+		/// @brief 直前の update で value() が変わった量
+		double deltaValue(Animation animation) const
+		{
+			return m_deltas[dense(animation)];
+		}
+
+		/// @brief イージングを掛けた進み具合
+		double transition(Animation animation) const
+		{
+			return m_eased[dense(animation)];
+		}
+
+	private:
+		struct Slot
+		{
+			uint32 dense;
+			uint32 generation;
+		};
+
+		// value() と deltaValue() の結果を i の今の値から計算し直す
+		void cache(size_t i) noexcept;
+
+		size_t dense(Animation animation) const
+		{
+			assert(contains(animation));
+			return m_slots[animation.index].dense;
+		}
+
+		// ハンドルから配列の位置へ。消したら末尾と入れ替えて詰めるので、位置はここで引き直す
+		Array<Slot>   m_slots = {};
+		Array<uint32> m_free  = {};
+
+		// 以下は全て同じ長さで、同じ位置が同じアニメーション
+		Array<double>   m_ratios    = {}; // 進み具合 [0, 1]
+		Array<double>   m_rates     = {}; // 1秒あたりの進み具合の変化。drive の向きで符号が変わる
+		Array<double>   m_inRates   = {};
+		Array<double>   m_outRates  = {};
+		Array<double>   m_eased     = {};
+		Array<double>   m_prevEased = {};
+		Array<double>   m_starts    = {};
+		Array<double>   m_finishes  = {};
+		Array<double>   m_values    = {}; // value() の結果。m_eased か範囲が変わった時だけ計算し直す
+		Array<double>   m_deltas    = {}; // deltaValue() の結果
+		Array<EaseFunc> m_easeFuncs = {};
+		Array<uint32>   m_owners    = {}; // 配列の位置から m_slots の位置へ
+	};
+} // namespace tomolatoon
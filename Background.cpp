@@ -0,0 +1,50 @@
+﻿#include "Background.hpp"
+
+namespace tomolatoon
+{
+	const Texture& BlurredBackgroundCache::get(uint32 id, const Texture& icon, Size size)
+	{
+		const Key key = {id, size};
+
+		if (auto it = std::ranges::find(m_entries, key, &Entry::key); it != m_entries.end())
+		{
+			// 先頭に持ってくる
+			std::rotate(m_entries.begin(), it, std::next(it));
+		}
+		else
+		{
+			if (m_entries.size() >= m_capacity)
+			{
+				m_entries.pop_back();
+			}
+
+			m_entries.push_front(Entry{key, build(icon, size)});
+		}
+
+		return m_entries.front().texture.get();
+	}
+
+	RenderTexturePool::Lease BlurredBackgroundCache::build(const Texture& icon, Size size)
+	{
+		const int32 max         = Max(size.x, size.y);
+		const auto  iconResized = icon.resized(max);
+
+		// 強力なぼかし
+		const auto buffer1 = m_pool.acquire(iconResized.size.asPoint());
+		const auto to1     = m_pool.acquire(iconResized.size.asPoint());
+
+		const auto buffer4 = m_pool.acquire(iconResized.size.asPoint() / 4);
+		const auto to4     = m_pool.acquire(iconResized.size.asPoint() / 4);
+
+		const auto buffer8 = m_pool.acquire(iconResized.size.asPoint() / 8);
+		auto       to8     = m_pool.acquire(iconResized.size.asPoint() / 8);
+
+		Shader::GaussianBlur(iconResized, *buffer1, *to1);
+		Shader::Downsample(*to1, *to4);
+		Shader::GaussianBlur(*to4, *buffer4, *to4);
+		Shader::Downsample(*to4, *to8);
+		Shader::GaussianBlur(*to8, *buffer8, *to8);
+
+		return to8;
+	}
+} // namespace tomolatoon
@@ -0,0 +1,63 @@
+﻿#pragma once
+
+#include <Siv3D.hpp>
+
+#include "RenderTexturePool.hpp"
+
+namespace tomolatoon
+{
+	// 選択中のゲームのアイコンを強くぼかした背景を、ゲームの Id と出力サイズ毎にキャッシュする
+	// 直近に使われたものから capacity 個までを保持し、溢れたら最も古く使われたものから捨てる
+	// RenderTexture は全て pool から借りるので、捨てたものは次に作る背景で使い回される
+	struct BlurredBackgroundCache
+	{
+		BlurredBackgroundCache(RenderTexturePool& pool, size_t capacity = 16) noexcept
+			: m_pool(pool)
+			, m_capacity(Max<size_t>(capacity, 1))
+		{}
+
+		/// @brief id のゲームの背景を取得する。キャッシュに無ければ icon から作成する。
+		/// @param id ゲームの Id
+		/// @param icon ぼかす元となるアイコン
+		/// @param size 背景を描画する領域のサイズ。変わった場合は作り直す。古いサイズのものは残るので、変わった時は clear() を呼ぶ
+		const Texture& get(uint32 id, const Texture& icon, Size size);
+
+		void clear() noexcept
+		{
+			m_entries.clear();
+		}
+
+		size_t size() const noexcept
+		{
+			return m_entries.size();
+		}
+
+		size_t capacity() const noexcept
+		{
+			return m_capacity;
+		}
+
+	private:
+		struct Key
+		{
+			bool operator==(const Key&) const = default;
+
+			uint32 id;
+			Size   size;
+		};
+
+		struct Entry
+		{
+			Key                      key;
+			RenderTexturePool::Lease texture;
+		};
+
+		RenderTexturePool::Lease build(const Texture& icon, Size size);
+
+		RenderTexturePool& m_pool;
+
+		// 先頭ほど最近使われたもの
+		Array<Entry> m_entries  = {};
+		size_t       m_capacity = 16;
+	};
+} // namespace tomolatoon
@@ -0,0 +1,448 @@
+﻿// List::Update をウィンドウ無しで動かす計測用のコンソールアプリ
+// 決まった入力 (掴む、弾く、止まる) を List::Context に流し、1フレームあたりの時間と state の遷移を出力する
+// また、Main と同じ CardDrawer のカードを List::Draw で描画した時の1フレームあたりの時間と、Iframe 領域を1回問い合わせる速さ (IframeStack と Graphics2D::GetViewport()) を出力する
+// AnimationSystem は、数千本を同時に動かした時の1フレームあたりの時間を s3d::Transition を1つずつ進める場合と比べる
+// Unicode 特性表と書記素クラスタの区切り方、改行位置が、実行時の ICU や前の区切り方と一致するかもここで確かめる (UnicodeBench.cpp)
+
+#include <Siv3D.hpp> // OpenSiv3D v0.6.5
+
+#include <chrono>
+
+#include "Card.hpp"
+#include "List.hpp"
+#include "UnicodeBench.hpp"
+
+SIV3D_SET(EngineOption::Renderer::Headless)
+
+namespace tomolatoon::Bench
+{
+	// 同じ入力を続けるフレームの並び
+	struct Phase
+	{
+		StringView name;
+		int32      frames;
+		bool       pressed;
+		double     cursorDeltaY; // 1フレームあたり
+	};
+
+	// 掴んでゆっくり動かす -> 離して止まる -> 弾いて惰性で流れる -> 掴んで止める
+	const Array<Phase> Script = {
+		{U"idle", 60, false, 0.0},
+		{U"drag", 60, true, -12.0},
+		{U"stop", 240, false, 0.0},
+		{U"fling", 8, true, -400.0},
+		{U"coast", 600, false, 0.0},
+		{U"hold", 30, true, 0.0},
+		{U"settle", 120, false, 0.0},
+	};
+
+	constexpr double SceneHeight = 1080.0;
+	constexpr double DeltaSec    = 1.0 / 60;
+	constexpr int32  Runs        = 20;
+
+	StringView StateName(List::Context::State state)
+	{
+		switch (state)
+		{
+			using enum List::Context::State;
+		case MouseHandled: return U"MouseHandled";
+		case Coasting: return U"Coasting";
+		case ToStoppingFirst: return U"ToStoppingFirst";
+		case ToStopping: return U"ToStopping";
+		case StoppingFirst: return U"StoppingFirst";
+		case Stopping: return U"Stopping";
+		}
+
+		return U"?";
+	}
+
+	struct PhaseResult
+	{
+		int64 totalNs = 0;
+		int64 maxNs   = 0;
+		int32 frames  = 0;
+	};
+
+	List::Context MakeContext(size_t cardCount)
+	{
+		List::Context context{SceneHeight};
+
+		for (size_t i = 0; i < cardCount; ++i)
+		{
+			context.append(context.dic.add([](double, double) {}));
+		}
+
+		return context;
+	}
+
+	/// @brief Script を1回流す
+	/// @param trace state が変わる度に出力するか
+	void RunScript(size_t cardCount, Array<PhaseResult>& results, bool trace)
+	{
+		using Clock = std::chrono::steady_clock;
+
+		List::Context context = MakeContext(cardCount);
+		List::Update  update;
+
+		double time  = 0.0;
+		int32  frame = 0;
+		auto   state = context.state;
+
+		for (size_t p = 0; p < Script.size(); ++p)
+		{
+			const Phase& phase = Script[p];
+
+			for (int32 i = 0; i < phase.frames; ++i, ++frame)
+			{
+				time += DeltaSec;
+
+				const List::FrameInput input{
+					.time         = time,
+					.deltaSec     = DeltaSec,
+					.pressed      = phase.pressed,
+					.clicked      = phase.pressed && i == 0,
+					.cursorDeltaY = phase.pressed ? phase.cursorDeltaY : 0.0,
+					.sceneHeight  = SceneHeight,
+				};
+
+				const auto begin = Clock::now();
+				update.update(context, input);
+				const int64 ns = std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - begin).count();
+
+				results[p].totalNs += ns;
+				results[p].maxNs    = Max(results[p].maxNs, ns);
+				results[p].frames  += 1;
+
+				if (trace && context.state != state)
+				{
+					Console << U"  {:>5} {:<7} {:>16} -> {:<16} index {:>6}  vel {:>10.1f}"_fmt(frame, phase.name, StateName(state), StateName(context.state), context.cur().index(), context.vel());
+				}
+
+				state = context.state;
+			}
+		}
+	}
+
+	void Run(size_t cardCount)
+	{
+		Console << U"== {} cards =="_fmt(cardCount);
+
+		{
+			const auto  begin = std::chrono::steady_clock::now();
+			const auto  context = MakeContext(cardCount);
+			const int64 ns      = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - begin).count();
+			Console << U"setup: {:.2f} ms"_fmt(ns / 1e6);
+		}
+
+		Console << U"state transitions:";
+
+		Array<PhaseResult> results(Script.size());
+
+		for (int32 run = 0; run < Runs; ++run)
+		{
+			RunScript(cardCount, results, run == 0);
+		}
+
+		Console << U"{:<7} {:>12} {:>12}"_fmt(U"phase", U"ns/frame", U"max ns");
+
+		for (size_t p = 0; p < Script.size(); ++p)
+		{
+			Console << U"{:<7} {:>12.0f} {:>12}"_fmt(Script[p].name, static_cast<double>(results[p].totalNs) / results[p].frames, results[p].maxNs);
+		}
+
+		Console << U"";
+	}
+
+	constexpr int32 DrawRuns  = 5;
+	constexpr int32 DrawCards = 1'000;
+
+	// Main の既定のカードの見た目
+	const CardDrawer::Style CardStyle = {
+		.background           = ColorF{0.45, 0.40, 0.60, 0.70},
+		.titleHeight          = 40,
+		.authorHeight         = 35,
+		.titleY               = 2.45,
+		.authorY              = 47,
+		.scrollVelocity       = 250,
+		.additionalHiddenTime = 1.0,
+	};
+
+	// 流れる長さのものと収まる長さのものを混ぜる
+	Array<Game> MakeGames(size_t count)
+	{
+		Array<Game> games(count);
+
+		for (size_t i = 0; i < count; ++i)
+		{
+			games[i].id     = GameId::Allocate();
+			games[i].title  = (i % 3 == 0) ? U"とても長いタイトルのゲーム {} ～ 流れて読めるようになるまで ～"_fmt(i) : U"ゲーム {}"_fmt(i);
+			games[i].author = U"作者 {}"_fmt(i % 17);
+		}
+
+		return games;
+	}
+
+	// Main と同じ CardDrawer でカードを描く List を、Script の入力で動かしながら List::Draw で描画する
+	void RunDraw()
+	{
+		using Clock = std::chrono::steady_clock;
+
+		if (not FontAsset::IsRegistered(U"Black"))
+		{
+			FontAsset::Register(U"Black", 72, Typeface::Mplus_Black);
+		}
+
+		RenderTexturePool pool;
+		LayoutTree        layout;
+		TextMeasureCache  textMeasureCache;
+		MarqueeCache      marqueeCache{pool};
+		DamageTracker     damage;
+		const CardDrawer  card{layout, textMeasureCache, marqueeCache, damage};
+		const Array<Game> games = MakeGames(DrawCards);
+
+		Array<PhaseResult> results(Script.size());
+
+		for (int32 run = 0; run < DrawRuns; ++run)
+		{
+			List::Context context{SceneHeight};
+			List::Update  update;
+			List::Draw    draw{pool};
+
+			for (size_t i = 0; i < games.size(); ++i)
+			{
+				context.append(context.dic.add([&card, &games, i](double per, double stopTime) { card.draw(games[i], CardStyle, per, stopTime); }));
+			}
+
+			double time = 0.0;
+
+			for (size_t p = 0; p < Script.size(); ++p)
+			{
+				const Phase& phase = Script[p];
+
+				for (int32 i = 0; i < phase.frames; ++i)
+				{
+					time += DeltaSec;
+
+					update.update(context, List::FrameInput{
+						.time         = time,
+						.deltaSec     = DeltaSec,
+						.pressed      = phase.pressed,
+						.clicked      = phase.pressed && i == 0,
+						.cursorDeltaY = phase.pressed ? phase.cursorDeltaY : 0.0,
+						.sceneHeight  = SceneHeight,
+					});
+
+					const auto begin = Clock::now();
+					{
+						const ScopedIframe2D iframe{Rect{0, 0, 1920, static_cast<int32>(SceneHeight)}, ScopedIframe2DCropped::No, ScopedIframe2DForceIntersects::No};
+						draw.draw(context);
+					}
+					const int64 ns = std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - begin).count();
+
+					results[p].totalNs += ns;
+					results[p].maxNs    = Max(results[p].maxNs, ns);
+					results[p].frames  += 1;
+				}
+			}
+		}
+
+		Console << U"== List::Draw ({} cards, CardDrawer) =="_fmt(DrawCards);
+		Console << U"{:<7} {:>12} {:>12}"_fmt(U"phase", U"ns/frame", U"max ns");
+
+		for (size_t p = 0; p < Script.size(); ++p)
+		{
+			Console << U"{:<7} {:>12.0f} {:>12}"_fmt(Script[p].name, static_cast<double>(results[p].totalNs) / results[p].frames, results[p].maxNs);
+		}
+
+		Console << U"";
+	}
+
+	constexpr int32 IframeQueries = 1'000'000;
+
+	// Iframe 領域を1回問い合わせる速さ
+	// IframeStack を使う前は、問い合わせる度に Graphics2D::GetViewport() を呼んでいた
+	void RunIframe()
+	{
+		Console << U"== Iframe queries ({} queries) =="_fmt(IframeQueries);
+
+		// headless のレンダラーで測るので、Direct3D 11 で動かした時の値とは異なる
+		const auto measure = [](auto query) {
+			const ScopedIframe2D iframe{Rect{0, 0, 1920, static_cast<int32>(SceneHeight)}, ScopedIframe2DCropped::No, ScopedIframe2DForceIntersects::No};
+
+			int64 sink = 0;
+
+			const auto begin = std::chrono::steady_clock::now();
+
+			for (int32 i = 0; i < IframeQueries; ++i)
+			{
+				sink += query().w;
+			}
+
+			const int64 ns = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - begin).count();
+
+			return std::pair{static_cast<double>(ns) / IframeQueries, sink};
+		};
+
+		const auto [legacy, legacySink]   = measure([] { return Graphics2D::GetViewport().value_or(Scene::Rect()); });
+		const auto [current, currentSink] = measure([] { return Iframe::RectAtScene(); });
+
+		Console << U"{:<12} {:>12}"_fmt(U"", U"ns/query");
+		Console << U"{:<12} {:>12.2f}"_fmt(U"GetViewport", legacy);
+		Console << U"{:<12} {:>12.2f}"_fmt(U"IframeStack", current);
+		Console << U"checksum: {} / {}"_fmt(legacySink, currentSink);
+		Console << U"";
+	}
+
+	constexpr int32 AnimationFrames = 600;
+	constexpr int32 FlipFrames      = 30; // 動かしているものはこのフレーム毎に向きを変え、端に着かないようにする
+
+	// 描く側が毎フレーム読んだ値を置いておく所から、最適化で消されないように読み出す
+	// 1本の足し算に繋げて読むと加算の待ち時間が律速になり、読む側の計算の重さが見えなくなるので、最後に纏めて足す
+	int64 Checksum(const Array<double>& values, double sink)
+	{
+		for (const double value : values)
+		{
+			sink += value;
+		}
+
+		return static_cast<int64>(sink);
+	}
+
+	// 先頭から moving 本だけを往復させ続け、残りは 0 で止めておく
+	// List と同じく、毎フレーム全ての value() と deltaValue() を読む
+	int64 RunAnimationSystem(size_t count, size_t moving)
+	{
+		AnimationSystem  system;
+		Array<Animation> animations;
+
+		for (size_t i = 0; i < count; ++i)
+		{
+			animations.push_back(system.add(2.0s, 2.0s, 0.0, 100.0, EaseOutQuint, i < moving ? 0.5 : 0.0));
+		}
+
+		Array<double> values(count);
+		double        sink = 0.0;
+
+		for (int32 frame = 0; frame < AnimationFrames; ++frame)
+		{
+			if (frame % FlipFrames == 0)
+			{
+				for (size_t i = 0; i < moving; ++i)
+				{
+					system.drive(animations[i], (frame / FlipFrames) % 2 == 0);
+				}
+			}
+
+			system.update(DeltaSec);
+
+			for (size_t i = 0; i < count; ++i)
+			{
+				values[i] = system.value(animations[i]) + system.deltaValue(animations[i]);
+			}
+
+			sink += values[frame % count];
+		}
+
+		return Checksum(values, sink);
+	}
+
+	// AnimationSystem を使う前の LerpTransition と同じ書き方
+	// 1本ずつ s3d::Transition を進め、value() と deltaValue() を読む度にイージングを計算する
+	struct PerObjectTransition
+	{
+		Transition transition;
+		double     prev = 0.0;
+
+		void update(bool in, double deltaSec)
+		{
+			prev = transition.value();
+			transition.update(in, deltaSec);
+		}
+
+		double value() const
+		{
+			return Math::Lerp(0.0, 100.0, EaseOutQuint(transition.value()));
+		}
+
+		double deltaValue() const
+		{
+			return value() - Math::Lerp(0.0, 100.0, EaseOutQuint(prev));
+		}
+	};
+
+	int64 RunPerObject(size_t count, size_t moving)
+	{
+		Array<PerObjectTransition> transitions;
+
+		for (size_t i = 0; i < count; ++i)
+		{
+			const double init = i < moving ? 0.5 : 0.0;
+			transitions.push_back(PerObjectTransition{Transition{2.0s, 2.0s, init}, init});
+		}
+
+		Array<double> values(count);
+		double        sink = 0.0;
+
+		for (int32 frame = 0; frame < AnimationFrames; ++frame)
+		{
+			const bool in = (frame / FlipFrames) % 2 == 0;
+
+			for (size_t i = 0; i < count; ++i)
+			{
+				transitions[i].update(i < moving && in, DeltaSec);
+			}
+
+			for (size_t i = 0; i < count; ++i)
+			{
+				values[i] = transitions[i].value() + transitions[i].deltaValue();
+			}
+
+			sink += values[frame % count];
+		}
+
+		return Checksum(values, sink);
+	}
+
+	void RunAnimations()
+	{
+		Console << U"== Animations ({} frames) =="_fmt(AnimationFrames);
+		Console << U"{:>6} {:>7} {:>16} {:>16}"_fmt(U"count", U"moving", U"System ns/frame", U"PerObject ns/f");
+
+		const auto measure = [](auto func) {
+			const auto  begin = std::chrono::steady_clock::now();
+			const int64 sink  = func();
+			const int64 ns    = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - begin).count();
+			return std::pair{static_cast<double>(ns) / AnimationFrames, sink};
+		};
+
+		for (size_t count : {1'000, 5'000, 20'000})
+		{
+			for (double ratio : {0.0, 0.1, 1.0})
+			{
+				const size_t moving = static_cast<size_t>(count * ratio);
+
+				const auto [system, systemSink]       = measure([&] { return RunAnimationSystem(count, moving); });
+				const auto [perObject, perObjectSink] = measure([&] { return RunPerObject(count, moving); });
+
+				Console << U"{:>6} {:>6.0f}% {:>16.0f} {:>16.0f}{}"_fmt(count, ratio * 100, system, perObject, systemSink == perObjectSink ? U"" : U"  (results differ)");
+			}
+		}
+
+		Console << U"";
+	}
+} // namespace tomolatoon::Bench
+
+void Main()
+{
+	for (size_t cardCount : {10, 1'000, 10'000, 30'000, 100'000})
+	{
+		tomolatoon::Bench::Run(cardCount);
+	}
+
+	tomolatoon::Bench::RunDraw();
+	tomolatoon::Bench::RunIframe();
+	tomolatoon::Bench::RunAnimations();
+	tomolatoon::Bench::RunPropertyTable();
+	tomolatoon::Bench::RunGraphemes();
+	tomolatoon::Bench::RunLineBreaks();
+}
@@ -0,0 +1,337 @@
+﻿// Unicode 周りの検査と計測。ListBench から呼ぶ
+
+#include <Siv3D.hpp> // OpenSiv3D v0.6.5
+
+#include <chrono>
+
+#include "UnicodeBench.hpp"
+#include "GraphemeView.hpp"
+#include "LineBreak.hpp"
+#include "UnicodeProperty.hpp"
+
+namespace tomolatoon::Bench
+{
+	namespace
+	{
+		using namespace Unicode::Property;
+
+		// 全符号位置で、表から引いた値が実行時の ICU と一致するか
+		// 表を生成した ICU と実行時の ICU の版がずれるとここで分かる
+		bool VerifyPropertyTable()
+		{
+			for (char32 ch = 0; ch < 0x110000; ++ch)
+			{
+				if (GetLineBreak(ch) != GetProperty<ULineBreak, UCHAR_LINE_BREAK>(ch)
+					|| GetGraphemeClusterBreak(ch) != GetProperty<UGraphemeClusterBreak, UCHAR_GRAPHEME_CLUSTER_BREAK>(ch)
+					|| GetEastAsianWidth(ch) != GetProperty<UEastAsianWidth, UCHAR_EAST_ASIAN_WIDTH>(ch))
+				{
+					Console << U"mismatch at U+{:04X}"_fmt(static_cast<uint32>(ch));
+					return false;
+				}
+			}
+
+			return true;
+		}
+
+		constexpr int32 PropertyRuns = 20;
+
+		// 説明文に出てくる範囲 (ASCII、かな、CJK 統合漢字、絵文字) を順に引く
+		const Array<std::pair<char32, char32>> PropertyRanges = {
+			{0x0020, 0x007F},
+			{0x3040, 0x30FF},
+			{0x4E00, 0x9FFF},
+			{0x1F300, 0x1FAFF},
+		};
+
+		template <class Lookup>
+		std::pair<double, int64> MeasureLookup(Lookup lookup)
+		{
+			int64 sink    = 0;
+			int64 lookups = 0;
+
+			const auto begin = std::chrono::steady_clock::now();
+
+			for (int32 run = 0; run < PropertyRuns; ++run)
+			{
+				for (const auto& [first, last] : PropertyRanges)
+				{
+					for (char32 ch = first; ch <= last; ++ch)
+					{
+						sink += lookup(ch);
+					}
+
+					lookups += last - first + 1;
+				}
+			}
+
+			const int64 ns = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - begin).count();
+
+			return {static_cast<double>(ns) / lookups, sink};
+		}
+
+		// Bench/ から実行した時の data.json
+		constexpr StringView DataPath = U"../data.json";
+
+		// カタログの説明文。読めなければ空
+		Array<String> LoadDescriptions()
+		{
+			const JSON json = JSON::Load(DataPath);
+
+			if (not json)
+			{
+				Console << U"{} を読めなかったので、説明文は使わない"_fmt(DataPath);
+				return {};
+			}
+
+			Array<String> descriptions;
+
+			for (const auto& game : json[U"games"].arrayView())
+			{
+				descriptions.push_back(game[U"description"].getString());
+			}
+
+			return descriptions;
+		}
+
+		// 絵文字の ZWJ 結合や異体字セレクタなど、ICU に任せる所を通る文字列
+		const Array<String> GraphemeSamples = {
+			U"👨‍👩‍👧‍👦 と 🏳️‍🌈 と 👩🏽‍💻",
+			U"🇯🇵🇺🇸🇬🇧 の国旗、1️⃣ と #️⃣、👍🏻👍🏿",
+			U"か\u3099き\u3099く\u3099 と ﾊﾟﾋﾟﾌﾟ",
+			U"葛\U000E0100飾区 と 辻\U000E0101",
+			U"한국어 각 と e\u0301\u0302",
+			U"行末\r\n次の行\n最後の行",
+			U"C++20 Ranges は結局のところイテレータペアのラッパーでしかなく、実際の処理はイテレータに殆どぶん投げられています。",
+		};
+
+		namespace Legacy
+		{
+			// GraphemeSegmenter を使う前の GraphemeView::iterator と同じ区切り方
+			// 1文字読む度に、書記素クラスタの先頭からそこまでを UTF-16 に変換し直して ICU に渡し、末尾で区切れるかを見る
+			Array<size_t> GraphemeBoundaries(StringView text)
+			{
+				icu::ErrorCode                                         errorCode;
+				std::unique_ptr<UText, decltype(utext_close)*>         utext{utext_openUChars(NULL, u"", 0, errorCode), utext_close};
+				std::unique_ptr<UBreakIterator, decltype(ubrk_close)*> brkit{ubrk_open(UBRK_CHARACTER, uloc_getDefault(), NULL, 0, errorCode), ubrk_close};
+
+				Array<size_t> boundaries = {0};
+
+				for (size_t pos = 0; pos < text.size();)
+				{
+					std::u16string u16buffer = s3d::Unicode::ToUTF16(text.substr(pos, 1));
+					size_t         end       = pos + 1;
+
+					for (; end < text.size(); ++end)
+					{
+						u16buffer += s3d::Unicode::ToUTF16(text.substr(end, 1));
+
+						utext_openUChars(utext.get(), u16buffer.c_str(), u16buffer.size(), errorCode);
+						ubrk_setUText(brkit.get(), utext.get(), errorCode);
+
+						if (ubrk_next(brkit.get()) != static_cast<int32>(u16buffer.size()))
+						{
+							break;
+						}
+					}
+
+					boundaries.push_back(pos = end);
+				}
+
+				return boundaries;
+			}
+		} // namespace Legacy
+
+		Array<size_t> GraphemeBoundaries(StringView text)
+		{
+			Array<size_t> boundaries = {0};
+
+			for (const StringView grapheme : text | views::graphme)
+			{
+				boundaries.push_back(boundaries.back() + grapheme.size());
+			}
+
+			return boundaries;
+		}
+
+		constexpr int32 GraphemeRuns = 200;
+
+		// 禁則、数字の並び、ハイフン、ZWJ、ヘブライ文字など、UAX #14 の規則を一通り通る文字列
+		const Array<String> LineBreakSamples = {
+			U"価格は$(100)です。または100%、(12.5)%、-5、+3 です",
+			U"שָׁלוֹם-עולם ו/ש",
+			U"a\u200Db と \u200Dあ と 👨‍👩‍👧 と x\u200D(",
+			U"「かっこ」『二重』（全角）、ーーぁぃぅ。",
+			U"English words, numbers 1,234.56 and e.g. http://example.com/a-b?c=d",
+			U"$-5 (3)-4 12/31 US$100 ¥1,000 1.2.3-beta",
+			U"見出し——本文…続き・中黒 〜波 ゠ ヽヾ",
+			U"行末\r\n次の行\n最後の行",
+		};
+
+		// text を書記素クラスタに分けた時、各書記素の前で改行してよいか
+		Array<bool> LineBreaks(StringView text)
+		{
+			const auto                   view = text | views::graphme;
+			const Array<StringView>      graphemes(view.begin(), view.end());
+			const LineBreakOpportunities opportunities{graphemes};
+
+			Array<bool> result(graphemes.size(), false);
+
+			for (size_t i = 1; i < graphemes.size(); ++i)
+			{
+				result[i] = opportunities.canBreakBefore(i);
+			}
+
+			return result;
+		}
+
+		// 同じ事を ICU の行区切り (ja@lb=strict) で。書記素の先頭に当たる位置だけ拾う
+		Array<bool> IcuLineBreaks(StringView text)
+		{
+			const std::u16string u16 = s3d::Unicode::ToUTF16(text);
+
+			icu::ErrorCode                                         errorCode;
+			std::unique_ptr<UBreakIterator, decltype(ubrk_close)*> brkit{ubrk_open(UBRK_LINE, "ja@lb=strict", u16.c_str(), static_cast<int32>(u16.size()), errorCode), ubrk_close};
+
+			// UTF-16 の位置から UTF-32 の位置へ
+			Array<size_t> to32(u16.size() + 1, 0);
+
+			for (size_t pos16 = 0, pos32 = 0; pos32 <= text.size(); ++pos32)
+			{
+				to32[pos16] = pos32;
+				pos16 += (pos32 < text.size() && text[pos32] >= 0x10000) ? 2 : 1;
+			}
+
+			Array<bool> breaks(text.size() + 1, false);
+
+			for (int32 pos16 = ubrk_first(brkit.get()); pos16 != UBRK_DONE; pos16 = ubrk_next(brkit.get()))
+			{
+				breaks[to32[pos16]] = true;
+			}
+
+			Array<bool> result;
+			size_t      pos = 0;
+
+			for (const StringView grapheme : text | views::graphme)
+			{
+				result.push_back(pos != 0 && breaks[pos]);
+				pos += grapheme.size();
+			}
+
+			return result;
+		}
+	} // namespace
+
+	void RunPropertyTable()
+	{
+		Console << U"== Unicode property table ==";
+		Console << U"matches ICU: {}"_fmt(VerifyPropertyTable() ? U"yes" : U"NO");
+
+		// 表に詰めてある3つの特性を1文字ずつ引く
+		const auto [table, tableSink] = MeasureLookup([](char32 ch) {
+			return static_cast<int64>(GetLineBreak(ch)) + GetGraphemeClusterBreak(ch) + GetEastAsianWidth(ch);
+		});
+		const auto [icu, icuSink] = MeasureLookup([](char32 ch) {
+			return static_cast<int64>(GetProperty<ULineBreak, UCHAR_LINE_BREAK>(ch)) + GetProperty<UGraphemeClusterBreak, UCHAR_GRAPHEME_CLUSTER_BREAK>(ch) + GetProperty<UEastAsianWidth, UCHAR_EAST_ASIAN_WIDTH>(ch);
+		});
+
+		Console << U"{:<12} {:>12}"_fmt(U"", U"ns/char");
+		Console << U"{:<12} {:>12.2f}"_fmt(U"table", table);
+		Console << U"{:<12} {:>12.2f}"_fmt(U"ICU", icu);
+		Console << U"checksum: {} / {}"_fmt(tableSink, icuSink);
+		Console << U"";
+	}
+
+	void RunGraphemes()
+	{
+		Array<String> texts = GraphemeSamples;
+		texts.append(LoadDescriptions());
+
+		Console << U"== Graphemes ({} texts) =="_fmt(texts.size());
+
+		// 前の区切り方と1箇所でも違えば、その文字列を出す
+		size_t matched = 0;
+
+		for (const String& text : texts)
+		{
+			if (GraphemeBoundaries(text) == Legacy::GraphemeBoundaries(text))
+			{
+				++matched;
+			}
+			else
+			{
+				Console << U"differs from legacy: {}"_fmt(text);
+			}
+		}
+
+		Console << U"matches legacy: {} / {}"_fmt(matched, texts.size());
+
+		const auto measure = [&](auto boundaries) {
+			size_t chars = 0;
+			int64  sink  = 0;
+
+			const auto begin = std::chrono::steady_clock::now();
+
+			for (int32 run = 0; run < GraphemeRuns; ++run)
+			{
+				for (const String& text : texts)
+				{
+					sink += static_cast<int64>(boundaries(text).size());
+					chars += text.size();
+				}
+			}
+
+			const int64 ns = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - begin).count();
+
+			return std::pair{static_cast<double>(ns) / chars, sink};
+		};
+
+		const auto [legacy, legacySink]   = measure([](StringView text) { return Legacy::GraphemeBoundaries(text); });
+		const auto [current, currentSink] = measure([](StringView text) { return GraphemeBoundaries(text); });
+
+		Console << U"{:<12} {:>12}"_fmt(U"", U"ns/char");
+		Console << U"{:<12} {:>12.1f}"_fmt(U"Legacy", legacy);
+		Console << U"{:<12} {:>12.1f}"_fmt(U"Segmenter", current);
+		Console << U"checksum: {} / {}"_fmt(legacySink, currentSink);
+		Console << U"";
+	}
+
+	void RunLineBreaks()
+	{
+		Array<String> texts = LineBreakSamples;
+		texts.append(LoadDescriptions());
+
+		Console << U"== Line breaks ({} texts) =="_fmt(texts.size());
+
+		// ICU と1箇所でも違えば、その位置の前後を出す
+		size_t matched = 0;
+
+		for (const String& text : texts)
+		{
+			const Array<bool> ours = LineBreaks(text);
+			const Array<bool> icu  = IcuLineBreaks(text);
+
+			if (ours == icu)
+			{
+				++matched;
+				continue;
+			}
+
+			size_t i   = 0;
+			size_t pos = 0;
+
+			for (const StringView grapheme : text | views::graphme)
+			{
+				if (ours[i] != icu[i])
+				{
+					Console << U"differs from ICU (ours: {}): {} | {}"_fmt(ours[i] ? U"break" : U"keep", text.substr(pos >= 8 ? pos - 8 : 0, Min<size_t>(pos, 8)), text.substr(pos, 8));
+				}
+
+				pos += grapheme.size();
+				++i;
+			}
+		}
+
+		Console << U"matches ICU: {} / {}"_fmt(matched, texts.size());
+		Console << U"";
+	}
+} // namespace tomolatoon::Bench
@@ -0,0 +1,13 @@
+﻿#pragma once
+
+namespace tomolatoon::Bench
+{
+	// 生成済みの Unicode 特性表が実行時の ICU と一致するかを確かめ、引く速さを ICU と比べる
+	void RunPropertyTable();
+
+	// GraphemeView の区切り方が前の1文字ずつ ICU に問い合わせる区切り方と一致するかを確かめ、速さを比べる
+	void RunGraphemes();
+
+	// LineBreakOpportunities の改行位置が ICU の行区切り (ja@lb=strict) と一致するかを確かめる
+	void RunLineBreaks();
+} // namespace tomolatoon::Bench
@@ -0,0 +1,70 @@
+﻿#include "Card.hpp"
+#include "Units.hpp"
+#include "Viewport.hpp"
+
+namespace tomolatoon
+{
+	CardDrawer::CardDrawer(LayoutTree& layout, TextMeasureCache& textMeasureCache, MarqueeCache& marqueeCache, DamageTracker& damage)
+		: m_layout(layout)
+		, m_textMeasureCache(textMeasureCache)
+		, m_marqueeCache(marqueeCache)
+		, m_damage(damage)
+	{
+		using namespace Units;
+
+		m_card  = m_layout.addRoot();
+		m_icon  = m_layout.add(m_card, [] { return RectF{10_vw, static_cast<double>(Iframe::Center().y), 0, 0}; });
+		m_panel = m_layout.add(m_card, [] { return RectF{19_vw, 7.5_vh, 79.5_vw, 65_vh}; });
+		m_text  = m_layout.add(m_card, [] { return RectF{19_vw, 7.5_vh, 79.5_vw, 65_vh}.stretched(-1_vw, 0); });
+	}
+
+	void CardDrawer::draw(const Game& game, const Style& style, double per, double stopTime) const
+	{
+		using namespace Units;
+
+		// Background
+		Iframe::Rect().draw(style.background);
+
+		// カードの大きさは中央のカードだけ変わるので、変わった時だけ計算し直す
+		m_layout.resolve(m_card, Iframe::Size());
+
+		// Icon
+		game.icon().resized(Iframe::Height() * 0.8).drawAt(m_layout[m_icon].pos);
+
+		m_layout[m_panel].draw(Palette::Gray);
+
+		ScopedIframe2D iframe{m_layout[m_text].asRect()};
+
+		const bool enableScroll = per == 1.0 && stopTime > 0.5;
+
+		drawSingleline(game.title, style, enableScroll, vh(style.titleHeight), 1.5_vw, vh(style.titleY), stopTime - 0.5);
+		drawSingleline(game.author, style, enableScroll, vh(style.authorHeight), 2.0_vw, vh(style.authorY), stopTime - 0.5);
+	}
+
+	void CardDrawer::drawSingleline(const String& string, const Style& style, bool enableScroll, double fontSize, double x, double y, double time) const
+	{
+		const auto& [text, width] = m_textMeasureCache.get(U"Black", fontSize, string);
+
+		if (enableScroll && width > Iframe::Width())
+		{
+			const double xDiff = MarqueeDiff(time, style.additionalHiddenTime, style.scrollVelocity, width, Iframe::Width(), 1);
+
+			// 流れている間は毎フレーム変わる
+			m_damage.animated(Iframe::RectAtScene());
+
+			// 流れている間は帯にしたものを描画する
+			if (const Texture* strip = m_marqueeCache.get(U"Black", fontSize, string))
+			{
+				DrawMarquee(*strip, {0, y}, x + xDiff, Iframe::Width(), 1, strip->height());
+			}
+			else
+			{
+				text.draw(fontSize, x + xDiff, y);
+			}
+		}
+		else
+		{
+			text.draw(fontSize, x, y);
+		}
+	}
+} // namespace tomolatoon
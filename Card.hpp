@@ -0,0 +1,50 @@
+﻿#pragma once
+
+#include <Siv3D.hpp>
+
+#include "DataTypes.hpp"
+#include "Damage.hpp"
+#include "Layout.hpp"
+#include "Marquee.hpp"
+#include "TextLayout.hpp"
+
+namespace tomolatoon
+{
+	// リストのカード1枚 (背景、アイコン、タイトルと作者) を今の Iframe 領域に描画する
+	// Main のカードと ListBench の計測とで同じ描画を通るように、Main から切り出してある
+	struct CardDrawer
+	{
+		// カードの見た目。大きさと位置はカードの高さに対する割合 (vh)
+		struct Style
+		{
+			ColorF background;
+			double titleHeight;
+			double authorHeight;
+			double titleY;
+			double authorY;
+			double scrollVelocity;       // 文字を流す速さ[px/s]
+			double additionalHiddenTime; // 流し終えてから次に流し始めるまでの時間[s]
+		};
+
+		/// @brief カードの中の矩形を layout に登録する。文字はキャッシュから描画し、流れている所を damage に知らせる
+		CardDrawer(LayoutTree& layout, TextMeasureCache& textMeasureCache, MarqueeCache& marqueeCache, DamageTracker& damage);
+
+		/// @param per 中央のカードに向かう進み具合。1 の時だけ、入り切らない文字を流す
+		/// @param stopTime 止まってからの時間[s]
+		void draw(const Game& game, const Style& style, double per, double stopTime) const;
+
+	private:
+		void drawSingleline(const String& string, const Style& style, bool enableScroll, double fontSize, double x, double y, double time) const;
+
+		LayoutTree&       m_layout;
+		TextMeasureCache& m_textMeasureCache;
+		MarqueeCache&     m_marqueeCache;
+		DamageTracker&    m_damage;
+
+		// カードの大きさを根にした、カードの中の矩形
+		LayoutTree::Node m_card  = 0;
+		LayoutTree::Node m_icon  = 0;
+		LayoutTree::Node m_panel = 0;
+		LayoutTree::Node m_text  = 0;
+	};
+} // namespace tomolatoon
@@ -0,0 +1,283 @@
+﻿#include "CatalogCache.hpp"
+
+namespace tomolatoon
+{
+	namespace CatalogCache
+	{
+		namespace
+		{
+			// ファイル形式
+			// Header
+			//   char[8]  Magic
+			//   uint32   Version
+			//   uint32   ゲームの数
+			//   uint64   ソースのハッシュ
+			//   uint64   ファイル全体のバイト数
+			// Game (ゲームの数だけ)
+			//   Str      title, author, exe, iconPath
+			//   uint32   year
+			//   Str      description
+			//   double   background (r, g, b, a)
+			//   uint32   tags の数
+			//   Str      tags (tags の数だけ)
+			// Str
+			//   uint32   文字数
+			//   char32   文字 (文字数だけ)
+			constexpr char   Magic[8] = {'K', 'T', 'P', 'C', 'C', 'T', 'L', 'G'};
+			constexpr uint32 Version  = 1;
+
+			// 空文字列 5 つ、year、background、tags の数
+			constexpr size_t MinGameBytes = sizeof(uint32) * 5 + sizeof(uint32) + sizeof(double) * 4 + sizeof(uint32);
+
+			struct Header
+			{
+				char   magic[8];
+				uint32 version;
+				uint32 count;
+				uint64 sourceHash;
+				uint64 fileSize;
+			};
+
+			// FNV-1a
+			uint64 Hash(const void* data, size_t size, uint64 hash = 14'695'981'039'346'656'037ull) noexcept
+			{
+				const Byte* bytes = static_cast<const Byte*>(data);
+
+				for (size_t i = 0; i < size; ++i)
+				{
+					hash ^= static_cast<uint8>(bytes[i]);
+					hash *= 1'099'511'628'211ull;
+				}
+
+				return hash;
+			}
+
+			struct Reader
+			{
+				Reader(const Byte* data, size_t size) noexcept
+					: m_data(data)
+					, m_size(size)
+				{}
+
+				template <class T>
+				requires std::is_trivially_copyable_v<T>
+				bool read(T& value) noexcept
+				{
+					if (m_size - m_pos < sizeof(T))
+					{
+						return false;
+					}
+
+					std::memcpy(&value, m_data + m_pos, sizeof(T));
+					m_pos += sizeof(T);
+
+					return true;
+				}
+
+				bool read(String& value)
+				{
+					uint32 length = 0;
+
+					if (not read(length) || (m_size - m_pos) / sizeof(char32) < length)
+					{
+						return false;
+					}
+
+					value.resize(length);
+					std::memcpy(value.data(), m_data + m_pos, length * sizeof(char32));
+					m_pos += length * sizeof(char32);
+
+					return true;
+				}
+
+				size_t remaining() const noexcept
+				{
+					return m_size - m_pos;
+				}
+
+			private:
+				const Byte* m_data;
+				size_t      m_size;
+				size_t      m_pos = 0;
+			};
+
+			struct Writer
+			{
+				template <class T>
+				requires std::is_trivially_copyable_v<T>
+				void write(const T& value)
+				{
+					const auto p = reinterpret_cast<const Byte*>(&value);
+					m_buffer.insert(m_buffer.end(), p, p + sizeof(T));
+				}
+
+				void write(StringView value)
+				{
+					write(static_cast<uint32>(value.size()));
+
+					const auto p = reinterpret_cast<const Byte*>(value.data());
+					m_buffer.insert(m_buffer.end(), p, p + value.size() * sizeof(char32));
+				}
+
+				Array<Byte>& buffer() noexcept
+				{
+					return m_buffer;
+				}
+
+			private:
+				Array<Byte> m_buffer;
+			};
+		} // namespace
+
+		Optional<uint64> HashSources(FilePathView jsonPath, FilePathView schemaPath)
+		{
+			uint64 hash = Hash(&Version, sizeof(Version));
+
+			// 置き場所が変わったら iconPath も変わるので、JSON のフルパスも含める
+			const FilePath fullPath = FileSystem::FullPath(jsonPath);
+			hash                    = Hash(fullPath.data(), fullPath.size_bytes(), hash);
+
+			for (auto&& path : {jsonPath, schemaPath})
+			{
+				MemoryMappedFileView view{path};
+
+				if (not view)
+				{
+					return none;
+				}
+
+				const auto mapped = view.mapAll();
+				hash              = Hash(mapped.data, mapped.size, hash);
+			}
+
+			return hash;
+		}
+
+		FilePath PathFor(FilePathView jsonPath)
+		{
+			// ParentPath は末尾に / が付いている
+			return FileSystem::ParentPath(jsonPath) + FileSystem::BaseName(jsonPath) + U".catalog";
+		}
+
+		Optional<Array<Game>> Load(FilePathView cachePath, uint64 sourceHash)
+		{
+			if (not FileSystem::IsFile(cachePath))
+			{
+				return none;
+			}
+
+			MemoryMappedFileView view{cachePath};
+
+			if (not view)
+			{
+				return none;
+			}
+
+			const auto mapped = view.mapAll();
+			Reader     reader{mapped.data, mapped.size};
+			Header     header;
+
+			if (not reader.read(header)
+				|| std::memcmp(header.magic, Magic, sizeof(Magic)) != 0
+				|| header.version != Version
+				|| header.sourceHash != sourceHash
+				|| header.fileSize != mapped.size
+				|| header.count > reader.remaining() / MinGameBytes)
+			{
+				return none;
+			}
+
+			// 途中で壊れていることが分かった時に Id を無駄に払い出さないよう、全て読めてから Game を作る
+			struct Fields
+			{
+				String        title, author, exe, iconPath, description;
+				uint32        year = 0;
+				ColorF        background;
+				Array<String> tags;
+			};
+
+			Array<Fields> fields(header.count);
+
+			for (auto&& e : fields)
+			{
+				uint32 tagCount = 0;
+
+				if (not(reader.read(e.title) && reader.read(e.author) && reader.read(e.exe) && reader.read(e.iconPath)
+						&& reader.read(e.year) && reader.read(e.description)
+						&& reader.read(e.background.r) && reader.read(e.background.g) && reader.read(e.background.b) && reader.read(e.background.a)
+						&& reader.read(tagCount))
+					|| tagCount > reader.remaining() / sizeof(uint32))
+				{
+					return none;
+				}
+
+				e.tags.resize(tagCount);
+
+				for (auto&& tag : e.tags)
+				{
+					if (not reader.read(tag))
+					{
+						return none;
+					}
+				}
+			}
+
+			Array<Game> games;
+			games.reserve(fields.size());
+
+			for (auto&& e : fields)
+			{
+				games.push_back(Game{std::move(e.title), std::move(e.author), std::move(e.exe), std::move(e.iconPath), e.year, std::move(e.description), e.background, std::move(e.tags)});
+			}
+
+			return games;
+		}
+
+		bool Save(FilePathView cachePath, uint64 sourceHash, const Array<Game>& games)
+		{
+			Writer writer;
+
+			Header header;
+			std::memcpy(header.magic, Magic, sizeof(Magic));
+			header.version    = Version;
+			header.count      = static_cast<uint32>(games.size());
+			header.sourceHash = sourceHash;
+			header.fileSize   = 0;
+			writer.write(header);
+
+			for (auto&& game : games)
+			{
+				writer.write(game.title);
+				writer.write(game.author);
+				writer.write(game.exe);
+				writer.write(game.iconPath);
+				writer.write(game.year);
+				writer.write(game.description);
+				writer.write(game.background.r);
+				writer.write(game.background.g);
+				writer.write(game.background.b);
+				writer.write(game.background.a);
+				writer.write(static_cast<uint32>(game.tags.size()));
+
+				for (auto&& tag : game.tags)
+				{
+					writer.write(tag);
+				}
+			}
+
+			// 全体のサイズが分かったのでヘッダを埋める
+			Array<Byte>& buffer = writer.buffer();
+			const uint64 size   = buffer.size();
+			std::memcpy(buffer.data() + offsetof(Header, fileSize), &size, sizeof(size));
+
+			BinaryWriter file{cachePath};
+
+			if (not file)
+			{
+				return false;
+			}
+
+			return file.write(buffer.data(), buffer.size()) == static_cast<int64>(buffer.size());
+		}
+	} // namespace CatalogCache
+} // namespace tomolatoon
@@ -0,0 +1,30 @@
+﻿#pragma once
+
+#include <Siv3D.hpp>
+
+#include "Utility.hpp"
+#include "DataTypes.hpp"
+
+namespace tomolatoon
+{
+	// data.json を読み込んで検証した結果を、バイナリ形式で保存しておくキャッシュ
+	// data.json と data.schema.json の内容から作ったハッシュが一致する間は、JSON のパースと検証をせずにこれから Game を作る
+	namespace CatalogCache
+	{
+		/// @brief キャッシュの有効性の判定に使うハッシュ値を計算する。
+		/// @param jsonPath ゲームについてのデータの JSON
+		/// @param schemaPath JSON Schema
+		/// @return どちらかのファイルが読めなければ none
+		Optional<uint64> HashSources(FilePathView jsonPath, FilePathView schemaPath);
+
+		/// @brief jsonPath に対応するキャッシュファイルのパスを返す。
+		FilePath PathFor(FilePathView jsonPath);
+
+		/// @brief キャッシュを読み込んで Game を作る。
+		/// @return キャッシュが無い、壊れている、sourceHash と一致しない場合は none
+		Optional<Array<Game>> Load(FilePathView cachePath, uint64 sourceHash);
+
+		/// @brief games をキャッシュとして書き出す。書き出せなくても起動には影響しない。
+		bool Save(FilePathView cachePath, uint64 sourceHash, const Array<Game>& games);
+	} // namespace CatalogCache
+} // namespace tomolatoon
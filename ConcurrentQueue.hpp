@@ -0,0 +1,52 @@
+﻿#pragma once
+
+#include <Siv3D.hpp>
+
+#include <mutex>
+
+namespace tomolatoon
+{
+	// ワーカースレッドからメインスレッドへ値を受け渡すためのキュー
+	// push はどのスレッドからでも呼べ、受け取り側は takeAll で溜まっている分をまとめて取り出す
+	template <class T>
+	struct ConcurrentQueue
+	{
+		ConcurrentQueue() = default;
+
+		ConcurrentQueue(const ConcurrentQueue&)            = delete;
+		ConcurrentQueue& operator=(const ConcurrentQueue&) = delete;
+
+		void push(T value)
+		{
+			std::lock_guard lock{m_mutex};
+			m_queue.push_back(std::move(value));
+		}
+
+		void push(Array<T> values)
+		{
+			std::lock_guard lock{m_mutex};
+			m_queue.insert(m_queue.end(), std::make_move_iterator(values.begin()), std::make_move_iterator(values.end()));
+		}
+
+		[[nodiscard]] Array<T> takeAll()
+		{
+			std::lock_guard lock{m_mutex};
+			return std::exchange(m_queue, Array<T>{});
+		}
+
+		size_t size() const
+		{
+			std::lock_guard lock{m_mutex};
+			return m_queue.size();
+		}
+
+		bool empty() const
+		{
+			return size() == 0;
+		}
+
+	private:
+		mutable std::mutex m_mutex = {};
+		Array<T>           m_queue = {};
+	};
+} // namespace tomolatoon
@@ -0,0 +1,54 @@
+﻿#include "Damage.hpp"
+
+namespace tomolatoon
+{
+	void DamageTracker::beginFrame(bool changed)
+	{
+		m_full = m_full || changed;
+
+		m_regions.clear();
+		std::swap(m_regions, m_animated);
+
+		if (m_regions.size() > MaxRegions)
+		{
+			m_full = true;
+		}
+
+		if (m_full)
+		{
+			++m_stat.full;
+		}
+		else if (m_regions)
+		{
+			++m_stat.partial;
+		}
+		else
+		{
+			++m_stat.idle;
+		}
+	}
+
+	void DamageTracker::animated(const Rect& rect)
+	{
+		if (rect.w <= 0 || rect.h <= 0)
+		{
+			return;
+		}
+
+		// 同じ領域を何度も描き直さないように、既に含まれているものは登録しない
+		for (const Rect& region : m_animated)
+		{
+			if (region.contains(rect))
+			{
+				return;
+			}
+		}
+
+		m_animated.push_back(rect);
+	}
+
+	void DamageTracker::drawn() noexcept
+	{
+		m_full = false;
+	}
+} // namespace tomolatoon
@@ -0,0 +1,65 @@
+﻿#pragma once
+
+#include <Siv3D.hpp>
+
+namespace tomolatoon
+{
+	// 前のフレームから見た目が変わった領域を集める
+	// 何も変わらなかったフレームは描画を丸ごと省き、変わった領域だけを描き直せるようにする
+	struct DamageTracker
+	{
+		// これより多くの領域が変わったら、纏めて全体を描き直す
+		inline static constexpr size_t MaxRegions = 8;
+
+		struct Stat
+		{
+			size_t full    = 0; // 全体を描き直したフレーム数
+			size_t partial = 0; // 一部だけ描き直したフレーム数
+			size_t idle    = 0; // 描き直さなかったフレーム数
+		};
+
+		/// @brief update の最後に呼ぶ。前のフレームで animated() された領域が、このフレームで描き直す領域になる
+		/// @param changed 見た目を決める状態が前のフレームから変わったか。変わったら全体を描き直す
+		void beginFrame(bool changed);
+
+		/// @brief 次のフレームで全体を描き直す
+		void invalidateAll() noexcept
+		{
+			m_full = true;
+		}
+
+		/// @brief 描画中に、時間で変わるもの(流れている文字など)を描いた領域を登録する。次のフレームでもその領域を描き直す
+		/// @param rect シーン座標での領域
+		void animated(const Rect& rect);
+
+		/// @brief 描き直し終えたら呼ぶ
+		void drawn() noexcept;
+
+		bool isFull() const noexcept
+		{
+			return m_full;
+		}
+
+		bool isIdle() const noexcept
+		{
+			return not m_full && m_regions.isEmpty();
+		}
+
+		/// @brief 描き直す領域。isFull() の時は使わない
+		const Array<Rect>& regions() const noexcept
+		{
+			return m_regions;
+		}
+
+		const Stat& stat() const noexcept
+		{
+			return m_stat;
+		}
+
+	private:
+		bool        m_full     = true;
+		Array<Rect> m_regions  = {};
+		Array<Rect> m_animated = {};
+		Stat        m_stat     = {};
+	};
+} // namespace tomolatoon
@@ -5,37 +5,68 @@
 #include <Siv3D.hpp>
 
 #include <filesystem>
+#include <atomic>
 
 namespace tomolatoon
 {
+	// Game の Id
+	// 払い出す時にアイコンを登録する TextureAsset の名前も作っておき、以降は作り直さない
+	struct GameId
+	{
+		bool operator==(const GameId& other) const noexcept
+		{
+			return value == other.value;
+		}
+
+		/// @brief 新しい Id を払い出す。どのスレッドからでも呼べる。
+		static GameId Allocate()
+		{
+			const uint32 value = s_next.fetch_add(1, std::memory_order_relaxed);
+			return GameId{value, U"icon#{}"_fmt(value)};
+		}
+
+		uint32    value         = 0;
+		AssetName iconAssetName = {};
+
+	private:
+		inline static std::atomic<uint32> s_next = 0;
+	};
+
 	struct Game
 	{
-		uint32        id;
+		GameId        id;
 		String        title;
 		String        author;
 		URL           exe;
+		FilePath      iconPath;
 		uint32        year;
 		String        description;
 		ColorF        background;
 		Array<String> tags;
 
-		String getIdString() const
+		// デコードした時のアイコンの更新日時。読み直した時に、アイコンが変わったかどうかの判定に使う
+		Optional<DateTime> iconWriteTime = none;
+
+		const AssetName& iconAssetName() const noexcept
 		{
-			return String(reinterpret_cast<const char32_t*>(&id), 1);
+			return id.iconAssetName;
 		}
 
 		TextureAsset icon() const
 		{
-			return TextureAsset(getIdString() + U"_icon");
+			return TextureAsset(iconAssetName());
 		}
 
 #define FILEPATH ((jsonPath.parent_path() / json[U"icon"].get<URL>().toUTF32()).u32string())
 
+		Game() = default;
+
 		Game(const JSON& json, std::filesystem::path jsonPath)
-			: id(TextureAsset::Enumerate().size())
+			: id(GameId::Allocate())
 			, title(json[U"title"].get<String>())
 			, author(json[U"author"].get<String>())
 			, exe(json[U"exe"].get<URL>())
+			, iconPath(FILEPATH)
 			, year(json[U"year"].get<int32>())
 			, description(json[U"description"].get<String>())
 			, background([](auto&& e) -> ColorF {
@@ -43,10 +74,21 @@ namespace tomolatoon
 				else return HSV_(204, 100, 80);
 			}(json.hasElement(U"background") ? json[U"background"] : JSON::Invalid()))
 			, tags([](auto&& e) { Array<String> ret; for (auto&& [key,value] : e) { ret.push_back(value.get<String>()); } return ret; }(json[U"tags"]))
-		{
-			TextureAsset::Register(getIdString() + U"_icon", FILEPATH);
-		}
+		{}
 
 #undef FILEPATH
+
+		// CatalogCache から復元する時用
+		Game(String title, String author, URL exe, FilePath iconPath, uint32 year, String description, ColorF background, Array<String> tags)
+			: id(GameId::Allocate())
+			, title(std::move(title))
+			, author(std::move(author))
+			, exe(std::move(exe))
+			, iconPath(std::move(iconPath))
+			, year(year)
+			, description(std::move(description))
+			, background(background)
+			, tags(std::move(tags))
+		{}
 	};
 } // namespace tomolatoon
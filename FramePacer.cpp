@@ -0,0 +1,74 @@
+﻿#include "FramePacer.hpp"
+
+namespace tomolatoon
+{
+	FramePacer::~FramePacer()
+	{
+		if (m_tier != Tier::Full)
+		{
+			Apply(Tier::Full);
+		}
+	}
+
+	void FramePacer::update(const Activity& activity)
+	{
+		const double now = m_clock.sF();
+
+		// 前回からの時間は、その間のフレームレートの段階に付ける
+		switch (m_tier)
+		{
+		case Tier::Full:
+			m_stat.fullSec += now - m_prevSec;
+			break;
+		case Tier::Marquee:
+			m_stat.marqueeSec += now - m_prevSec;
+			break;
+		case Tier::Idle:
+			m_stat.idleSec += now - m_prevSec;
+			break;
+		}
+
+		m_prevSec = now;
+
+		if (activity.input)
+		{
+			m_lastInputSec = now;
+		}
+
+		Tier tier = Tier::Idle;
+
+		if (activity.input || activity.animating || now - m_lastInputSec < GraceSec)
+		{
+			tier = Tier::Full;
+		}
+		else if (activity.marquee)
+		{
+			tier = Tier::Marquee;
+		}
+
+		if (tier != m_tier)
+		{
+			m_tier = tier;
+			Apply(tier);
+		}
+	}
+
+	void FramePacer::Apply(Tier tier)
+	{
+		switch (tier)
+		{
+		case Tier::Full:
+			Graphics::SetTargetFrameRateHz(none);
+			Graphics::SetVSyncEnabled(true);
+			break;
+		case Tier::Marquee:
+			Graphics::SetVSyncEnabled(false);
+			Graphics::SetTargetFrameRateHz(MarqueeHz);
+			break;
+		case Tier::Idle:
+			Graphics::SetVSyncEnabled(false);
+			Graphics::SetTargetFrameRateHz(IdleHz);
+			break;
+		}
+	}
+} // namespace tomolatoon
@@ -0,0 +1,68 @@
+﻿#pragma once
+
+#include <Siv3D.hpp>
+
+namespace tomolatoon
+{
+	// 誰も触っていない間はフレームレートを落とす
+	// 入力があったフレームで直ちに元に戻すので、操作し始めの1フレームだけが遅いフレームになる
+	struct FramePacer
+	{
+		enum class Tier : uint8
+		{
+			Full,    // ディスプレイのリフレッシュレート (垂直同期)
+			Marquee, // 流れている文字だけが動いている
+			Idle,    // 何も動いていない
+		};
+
+		inline static constexpr double MarqueeHz = 30.0;
+		inline static constexpr double IdleHz    = 10.0;
+
+		// 最後の入力からこの時間は Full のままにする[s]
+		inline static constexpr double GraceSec = 1.0;
+
+		// 1フレームの間に起きたこと
+		struct Activity
+		{
+			bool input     = false; // カーソルの移動、クリック、キー入力、掴んでいる
+			bool animating = false; // スクロールなど、流れている文字以外が動いている
+			bool marquee   = false; // 流れている文字がある
+		};
+
+		struct Stat
+		{
+			double fullSec    = 0.0; // 各段階で過ごした時間[s]
+			double marqueeSec = 0.0;
+			double idleSec    = 0.0;
+		};
+
+		FramePacer() = default;
+
+		FramePacer(const FramePacer&)            = delete;
+		FramePacer& operator=(const FramePacer&) = delete;
+
+		~FramePacer();
+
+		/// @brief 毎フレーム1度呼ぶ。次のフレームからのフレームレートを決める
+		void update(const Activity& activity);
+
+		Tier tier() const noexcept
+		{
+			return m_tier;
+		}
+
+		const Stat& stat() const noexcept
+		{
+			return m_stat;
+		}
+
+	private:
+		static void Apply(Tier tier);
+
+		Tier      m_tier         = Tier::Full;
+		Stopwatch m_clock        = Stopwatch{StartImmediately::Yes};
+		double    m_prevSec      = 0.0;
+		double    m_lastInputSec = 0.0;
+		Stat      m_stat         = {};
+	};
+} // namespace tomolatoon
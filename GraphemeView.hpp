@@ -6,137 +6,270 @@
 
 #include <unicode/utypes.h>
 #include <unicode/ubrk.h>
+#include <unicode/utext.h>
+#include <unicode/utf16.h>
 #include <unicode/errorcode.h>
 
+#if defined(_M_X64) || defined(__SSE2__)
+# include <emmintrin.h>
+#endif
+
 #include "rivet.hpp"
+#include "UnicodeProperty.hpp"
 
 namespace tomolatoon
 {
-	template <std::ranges::input_range View>
-	requires std::ranges::view<View> && requires { requires sizeof std::ranges::range_value_t<View> == 4; }
-	struct GraphemeView : std::ranges::view_interface<GraphemeView<View>>
+	// 文字列を先頭から順に書記素クラスタに区切る
+	// 前後のどちらとも結合しない符号位置 (GCB が Other / Control / LF のもの) が続く所は ICU を使わずに1文字ずつ区切り、
+	// それ以外の部分だけを UTF-16 に変換して ICU で区切る。ASCII の連続は SSE2 で纏めて読み飛ばす
+	// UText が変換後の文字列を指しているので、ムーブもコピーも出来ない
+	struct GraphemeSegmenter
 	{
-		struct iterator
+		GraphemeSegmenter(const GraphemeSegmenter&)            = delete;
+		GraphemeSegmenter& operator=(const GraphemeSegmenter&) = delete;
+
+		explicit GraphemeSegmenter(StringView text)
+			: m_text(text)
+		{}
+
+		/// @brief 次の書記素クラスタを返す。
+		/// @return 末尾まで来ていたら none
+		Optional<StringView> next()
 		{
-			using value_type       = String;
-			using difference_type  = ptrdiff_t;
-			using iterator_concept = std::input_iterator_tag;
+			if (m_pos32 == m_text.size())
+			{
+				return none;
+			}
 
-			iterator(const iterator&)            = delete;
-			iterator(iterator&&)                 = default;
-			iterator& operator=(const iterator&) = delete;
-			iterator& operator=(iterator&&)      = default;
+			if (m_pos32 < m_spanEnd)
+			{
+				return nextInSpan();
+			}
 
-			iterator(const View& view)
-				: m_parent(std::addressof(view))
-				, m_it(std::ranges::begin(view))
+			if (m_pos32 >= m_simpleEnd)
 			{
-				++(*this);
+				m_simpleEnd = scanSimple(m_pos32);
 			}
 
-			const String& operator*() const
+			// 単純な符号位置同士の間は必ず区切れる。末尾も必ず区切れる
+			if (m_pos32 + 1 < m_simpleEnd || m_simpleEnd == m_text.size())
 			{
-				return m_grapehme;
+				return m_text.substr(m_pos32++, 1);
 			}
 
-			iterator& operator++()
+			// 次に単純な符号位置が2つ並ぶ所までを ICU で区切る
+			size_t end = m_pos32 + 1;
+
+			while (end < m_text.size() && not(IsSimple(m_text[end - 1]) && IsSimple(m_text[end])))
 			{
-				if (m_isEnd)
-				{
-					throw Error{U"[GraphemeView::Iterator::operator++] Out of range. Don't advance iterator over sentinel(end)."};
-				}
+				++end;
+			}
+
+			openSpan(end);
+
+			return nextInSpan();
+		}
+
+	private:
+		// 前後のどちらとも結合しない (書記素クラスタの境界が必ず両側にある) 符号位置か
+		static bool IsSimple(char32 ch) noexcept
+		{
+			if (ch < 0x80)
+			{
+				return ch != U'\r';
+			}
+
+			const UGraphemeClusterBreak gcb = Unicode::Property::GetGraphemeClusterBreak(ch);
+
+			return gcb == U_GCB_OTHER || gcb == U_GCB_CONTROL || gcb == U_GCB_LF;
+		}
 
-				if (m_it == std::ranges::end(*m_parent))
+		// pos から続く単純な符号位置の終わり
+		size_t scanSimple(size_t pos) const noexcept
+		{
+			const char32* data = m_text.data();
+			const size_t  size = m_text.size();
+
+#if defined(_M_X64) || defined(__SSE2__)
+			// SSE2 には符号無しの比較が無いので、両辺の最上位ビットを反転させてから符号付きで比べる
+			const __m128i bias  = _mm_set1_epi32(static_cast<int32>(0x80000000u));
+			const __m128i ascii = _mm_xor_si128(_mm_set1_epi32(0x80), bias);
+			const __m128i cr    = _mm_set1_epi32(U'\r');
+
+			for (; pos + 4 <= size; pos += 4)
+			{
+				const __m128i v      = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + pos));
+				const __m128i simple = _mm_andnot_si128(_mm_cmpeq_epi32(v, cr), _mm_cmplt_epi32(_mm_xor_si128(v, bias), ascii));
+
+				if (_mm_movemask_epi8(simple) != 0xFFFF)
 				{
-					m_isEnd = true;
+					break;
 				}
+			}
+#endif
+
+			while (pos < size && IsSimple(data[pos]))
+			{
+				++pos;
+			}
+
+			return pos;
+		}
+
+		// [m_pos32, end) を ICU で区切る準備をする
+		void openSpan(size_t end)
+		{
+			m_spanEnd = end;
+			m_u16     = s3d::Unicode::ToUTF16(m_text.substr(m_pos32, end - m_pos32));
+			m_pos16   = 0;
+
+			if (not m_brkit)
+			{
+				m_brkit.reset(ubrk_open(UBRK_CHARACTER, uloc_getDefault(), NULL, 0, m_errorCode));
+			}
+
+			// 既に開いている UText は使い回される
+			m_utext.reset(utext_openUChars(m_utext.release(), m_u16.c_str(), m_u16.size(), m_errorCode));
+
+			if (m_errorCode.isFailure())
+			{
+				throw Error{U"[GraphemeSegmenter::openSpan] {}"_fmt(s3d::Unicode::FromUTF8(m_errorCode.errorName()))};
+			}
+
+			ubrk_setUText(m_brkit.get(), m_utext.get(), m_errorCode);
+
+			if (m_errorCode.isFailure())
+			{
+				throw Error{U"[GraphemeSegmenter::openSpan] {}"_fmt(s3d::Unicode::FromUTF8(m_errorCode.errorName()))};
+			}
+		}
 
-				std::u16string u16buffer;
+		Optional<StringView> nextInSpan()
+		{
+			const int32 next16 = ubrk_next(m_brkit.get());
+			const int32 end16  = (next16 == UBRK_DONE ? static_cast<int32>(m_u16.size()) : next16);
+
+			// UTF-16 での境界を UTF-32 での境界に直す（サロゲートペアの後半は数えない）
+			size_t length = 0;
 
-				for (bool isFirst = true; m_it != std::ranges::end(*m_parent); ++m_it)
+			for (; m_pos16 < end16; ++m_pos16)
+			{
+				if (not U16_IS_TRAIL(m_u16[m_pos16]))
 				{
-					// コードポイント1つが多いことを考慮して始めに2つ読み込む
-					if (isFirst)
-					{
-						const char32 first = *m_it;
-						m_grapehme         = String{first};
-
-						if (++m_it != std::ranges::end(*m_parent))
-						{
-							const char32 second = *m_it;
-							u16buffer           = Unicode::ToUTF16(String{first, second});
-						}
-						else
-						{
-							break;
-						}
-
-						isFirst = false;
-					}
-					else
-					{
-						u16buffer += Unicode::ToUTF16(String{*m_it});
-					}
-
-					// ICU 初期化
-					{
-						utext_openUChars(m_utext.get(), u16buffer.c_str(), u16buffer.size(), m_errorCode);
-
-						if (m_errorCode.isFailure())
-						{
-							throw Error{U"[GraphemeView::Iterator::operator++] {}"_fmt(Unicode::FromUTF8(m_errorCode.errorName()))};
-						}
-
-						ubrk_setUText(m_brkit.get(), m_utext.get(), m_errorCode);
-
-						if (m_errorCode.isFailure())
-						{
-							throw Error{U"[GraphemeView::Iterator::operator++] {}"_fmt(Unicode::FromUTF8(m_errorCode.errorName()))};
-						}
-					}
-
-					// 書記素境界を見つけたら break
-					// ex) u16buffer: ["a", "b"], ubrk_next: 1, u16buffer.size: 2
-					if (ubrk_next(m_brkit.get()) != u16buffer.size())
-					{
-						break;
-					}
-
-					// 無駄な push_back と pop_back を避ける
-					m_grapehme.push_back(*m_it);
+					++length;
 				}
+			}
+
+			const StringView grapheme = m_text.substr(m_pos32, length);
+
+			m_pos32 += length;
+
+			return grapheme;
+		}
+
+		StringView                                             m_text;
+		size_t                                                 m_pos32     = 0;
+		size_t                                                 m_simpleEnd = 0; // [m_pos32, m_simpleEnd) は単純な符号位置
+		size_t                                                 m_spanEnd   = 0; // [m_pos32, m_spanEnd) は ICU で区切っている途中
+		std::u16string                                         m_u16       = {};
+		int32                                                  m_pos16     = 0;
+		icu::ErrorCode                                         m_errorCode = {};
+		std::unique_ptr<UText, decltype(utext_close)*>         m_utext     = {nullptr, utext_close};
+		std::unique_ptr<UBreakIterator, decltype(ubrk_close)*> m_brkit     = {nullptr, ubrk_close};
+	};
+
+	// 文字列を書記素クラスタ毎に見る view
+	// 境界は初めて使われた時に一度だけ求め、コピーした view 同士で共有するので、何度走査しても区切り直さない
+	// その最初の1回は const なメンバ関数からでも共有している境界を書き換えるので、コピーした view も含めて複数のスレッドから同時に使わないこと
+	template <std::ranges::contiguous_range View>
+	requires std::ranges::view<View> && std::ranges::sized_range<View> && requires { requires sizeof std::ranges::range_value_t<View> == 4; }
+	struct GraphemeView : std::ranges::view_interface<GraphemeView<View>>
+	{
+		// 書記素クラスタの境界 (UTF-32 での位置) を添字で引く双方向イテレータ
+		struct iterator
+		{
+			using value_type        = StringView;
+			using difference_type   = ptrdiff_t;
+			using iterator_concept  = std::bidirectional_iterator_tag;
+			using iterator_category = std::input_iterator_tag; // operator* が prvalue を返すので、旧来の forward iterator の要件は満たさない
+
+			iterator() = default;
+
+			iterator(const char32* data, const Array<size_t>* boundaries, size_t index) noexcept
+				: m_data(data)
+				, m_boundaries(boundaries)
+				, m_index(index)
+			{}
+
+			StringView operator*() const noexcept
+			{
+				const size_t begin = (*m_boundaries)[m_index];
+				return {m_data + begin, (*m_boundaries)[m_index + 1] - begin};
+			}
 
+			iterator& operator++() noexcept
+			{
+				++m_index;
 				return *this;
 			}
 
-			iterator& operator++(int)
+			iterator operator++(int) noexcept
+			{
+				iterator tmp = *this;
+				++(*this);
+				return tmp;
+			}
+
+			iterator& operator--() noexcept
 			{
-				return (*this)++;
+				--m_index;
+				return *this;
 			}
 
-			friend bool operator==(const iterator& it, const std::default_sentinel_t& sen)
+			iterator operator--(int) noexcept
 			{
-				return it.m_isEnd;
+				iterator tmp = *this;
+				--(*this);
+				return tmp;
+			}
+
+			/// @brief 何番目の書記素クラスタを指しているか
+			size_t index() const noexcept
+			{
+				return m_index;
+			}
+
+			friend bool operator==(const iterator& lhs, const iterator& rhs) noexcept
+			{
+				return lhs.m_index == rhs.m_index;
 			}
 
 		private:
-			const View*                                            m_parent;
-			std::ranges::iterator_t<const View>                    m_it;
-			bool                                                   m_isEnd     = false;
-			String                                                 m_grapehme  = U"";
-			icu::ErrorCode                                         m_errorCode = {};
-			std::unique_ptr<UText, decltype(utext_close)*>         m_utext     = {utext_openUChars(NULL, u"", 0, m_errorCode), utext_close};
-			std::unique_ptr<UBreakIterator, decltype(ubrk_close)*> m_brkit     = {ubrk_open(UBRK_CHARACTER, uloc_getDefault(), NULL, 0, m_errorCode), ubrk_close};
+			const char32*        m_data       = nullptr;
+			const Array<size_t>* m_boundaries = nullptr;
+			size_t               m_index      = 0;
 		};
 
 		iterator begin() const
 		{
-			return iterator{m_view};
+			return iterator{data(), &boundaries(), 0};
 		}
 
-		auto end() const
+		iterator end() const
 		{
-			return std::default_sentinel;
+			return iterator{data(), &boundaries(), size()};
+		}
+
+		/// @brief 書記素クラスタの数。初回は境界を求めるので O(n)、以降は O(1)
+		size_t size() const
+		{
+			return boundaries().size() - 1;
+		}
+
+		/// @brief index 番目の書記素クラスタ
+		StringView operator[](size_t index) const
+		{
+			return *iterator{data(), &boundaries(), index};
 		}
 
 		// clang-format off
@@ -144,7 +277,7 @@ namespace tomolatoon
 
 		// clang-format on
 
-		template <std::ranges::input_range Range>
+		template <std::ranges::contiguous_range Range>
 		requires std::ranges::viewable_range<Range>
 		GraphemeView(Range&& range)
 			: m_view(std::views::all(std::forward<Range>(range)))
@@ -155,10 +288,36 @@ namespace tomolatoon
 		{}
 
 	private:
-		View m_view;
+		const char32* data() const noexcept
+		{
+			return reinterpret_cast<const char32*>(std::ranges::data(m_view));
+		}
+
+		// 初めて必要になった時に全体を区切り、以降はコピーした view とも共有する
+		// 排他制御はしていないので、スレッド安全ではない
+		const Array<size_t>& boundaries() const
+		{
+			if (m_boundaries->isEmpty())
+			{
+				GraphemeSegmenter segmenter{StringView{data(), std::ranges::size(m_view)}};
+
+				size_t pos = 0;
+				m_boundaries->push_back(pos);
+
+				while (auto grapheme = segmenter.next())
+				{
+					m_boundaries->push_back(pos += grapheme->size());
+				}
+			}
+
+			return *m_boundaries;
+		}
+
+		View                           m_view;
+		std::shared_ptr<Array<size_t>> m_boundaries = std::make_shared<Array<size_t>>();
 	};
 
-	template <std::ranges::input_range Range>
+	template <std::ranges::contiguous_range Range>
 	requires std::ranges::viewable_range<Range>
 	GraphemeView(Range&&) -> GraphemeView<std::views::all_t<Range>>;
 
@@ -174,7 +333,7 @@ namespace tomolatoon
 				template <std::ranges::viewable_range Range>
 				constexpr auto operator()(Range&& range) const
 				{
-					return GraphemeView(std::forward<Range>(range));
+					return GraphemeView<std::views::all_t<Range>>(std::forward<Range>(range));
 				}
 			};
 		} // namespace detail
@@ -0,0 +1,69 @@
+﻿#include "Layout.hpp"
+
+namespace tomolatoon
+{
+	LayoutTree::LayoutTree()
+	{
+		addRoot();
+	}
+
+	LayoutTree::Node LayoutTree::add(Node parent, Expr expr)
+	{
+		const Node node = m_nodes.size();
+
+		m_nodes.push_back(Entry{std::move(expr), RectF{}, {}});
+		m_nodes[parent].children.push_back(node);
+
+		return node;
+	}
+
+	LayoutTree::Node LayoutTree::addRoot()
+	{
+		m_nodes.push_back(Entry{nullptr, RectF{}, {}});
+		return m_nodes.size() - 1;
+	}
+
+	void LayoutTree::update()
+	{
+		resolve(Root, Scene::Size());
+	}
+
+	void LayoutTree::resolve(Node root, const Size& size)
+	{
+		if (m_nodes[root].rect.asRect().size == size)
+		{
+			return;
+		}
+
+		m_nodes[root].rect = Rect{size};
+		resolveChildren(root);
+	}
+
+	void LayoutTree::invalidate() noexcept
+	{
+		// 根の大きさを 0 にしておけば、次に大きさを与えた時に必ず計算し直される
+		for (Entry& entry : m_nodes)
+		{
+			if (not entry.expr)
+			{
+				entry.rect = RectF{};
+			}
+		}
+	}
+
+	void LayoutTree::resolveChildren(Node node)
+	{
+		// Units は Iframe 領域の大きさしか見ないので、ビューポートは変えずに IframeStack にだけ積む
+		const detail::ScopedIframeStackEntry iframe{m_nodes[node].rect.asRect()};
+
+		for (const Node child : m_nodes[node].children)
+		{
+			m_nodes[child].rect = m_nodes[child].expr();
+		}
+
+		for (const Node child : m_nodes[node].children)
+		{
+			resolveChildren(child);
+		}
+	}
+} // namespace tomolatoon
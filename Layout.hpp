@@ -0,0 +1,57 @@
+﻿#pragma once
+
+#include <Siv3D.hpp>
+#include <functional>
+
+#include "Viewport.hpp"
+
+namespace tomolatoon
+{
+	// Units の式で書いた矩形を木にして、計算した結果を持っておく
+	// 各ノードの式は親の矩形を Iframe 領域として評価されるので、vw や vh は親に対する割合になる
+	// 大きさが変わった根の下だけを計算し直し、描画ではそれを読むだけにする
+	struct LayoutTree
+	{
+		using Node = size_t;
+		using Expr = std::function<RectF()>;
+
+		// シーン全体を表す根
+		inline static constexpr Node Root = 0;
+
+		LayoutTree();
+
+		/// @brief parent の中に矩形を追加する。計算されるのは次の update か resolve から
+		/// @param expr parent を Iframe 領域とした時の、parent の座標系での矩形
+		Node add(Node parent, Expr expr);
+
+		/// @brief シーンとは別に大きさが決まる根を追加する。大きさは resolve で与える
+		Node addRoot();
+
+		/// @brief シーンの大きさが変わっていれば Root の下を全て計算し直す
+		void update();
+
+		/// @brief root の大きさが前回と違えば root の下を計算し直す
+		void resolve(Node root, const Size& size);
+
+		/// @brief 次の update や resolve で全て計算し直す。式が読む値を変えた時に呼ぶ
+		void invalidate() noexcept;
+
+		/// @brief 親の座標系での矩形
+		const RectF& operator[](Node node) const noexcept
+		{
+			return m_nodes[node].rect;
+		}
+
+	private:
+		struct Entry
+		{
+			Expr        expr;
+			RectF       rect;
+			Array<Node> children;
+		};
+
+		void resolveChildren(Node node);
+
+		Array<Entry> m_nodes = {};
+	};
+} // namespace tomolatoon
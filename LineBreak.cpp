@@ -0,0 +1,228 @@
+﻿#include "LineBreak.hpp"
+#include "UnicodeProperty.hpp"
+
+namespace tomolatoon
+{
+	namespace
+	{
+		template <class... Classes>
+		bool IsOneOf(ULineBreak lb, Classes... classes) noexcept
+		{
+			return ((lb == classes) || ...);
+		}
+
+		// LB1 で解決した後の行分割クラス
+		ULineBreak ResolvedClass(char32 ch)
+		{
+			switch (const ULineBreak lb = Unicode::Property::GetLineBreak(ch))
+			{
+			case U_LB_AMBIGUOUS:
+			case U_LB_SURROGATE:
+			case U_LB_UNKNOWN:
+			case U_LB_COMPLEX_CONTEXT:
+				return U_LB_ALPHABETIC;
+			// 日本語の行頭禁則 (小書きの仮名や長音記号を行頭に置かない)
+			case U_LB_CONDITIONAL_JAPANESE_STARTER:
+				return U_LB_NONSTARTER;
+			// 単独の結合文字は AL として扱う (LB10)
+			case U_LB_COMBINING_MARK:
+			case U_LB_ZWJ:
+				return U_LB_ALPHABETIC;
+			default:
+				return lb;
+			}
+		}
+
+		// 書記素クラスタを前から見たクラス
+		// 書記素クラスタは結合文字を含んでいるので、LB9 は先頭の文字のクラスで代表させれば済む
+		ULineBreak LeadingClass(StringView grapheme)
+		{
+			return ResolvedClass(grapheme.front());
+		}
+
+		// 書記素クラスタを後ろから見たクラス
+		// 末尾の結合文字を飛ばした所の文字で代表させる (LB9)。空白や改行に付いた結合文字は AL になる (LB10)
+		// 肌の色の修飾のように、結合文字でない文字が後ろに付いて先頭とクラスが変わることもある
+		ULineBreak TrailingClass(StringView grapheme)
+		{
+			size_t last = grapheme.size() - 1;
+
+			while (last > 0 && IsOneOf(Unicode::Property::GetLineBreak(grapheme[last]), U_LB_COMBINING_MARK, U_LB_ZWJ))
+			{
+				--last;
+			}
+
+			const ULineBreak lb = ResolvedClass(grapheme[last]);
+
+			if (last + 1 < grapheme.size() && IsOneOf(lb, U_LB_MANDATORY_BREAK, U_LB_CARRIAGE_RETURN, U_LB_LINE_FEED, U_LB_NEXT_LINE, U_LB_SPACE, U_LB_ZWSPACE))
+			{
+				return U_LB_ALPHABETIC;
+			}
+
+			return lb;
+		}
+
+		// 東アジアの全角・半角の文字か (LB30 で括弧を分けるのに使う)
+		bool IsEastAsian(StringView grapheme)
+		{
+			const UEastAsianWidth eaw = Unicode::Property::GetEastAsianWidth(grapheme.front());
+			return eaw == U_EA_FULLWIDTH || eaw == U_EA_WIDE || eaw == U_EA_HALFWIDTH;
+		}
+
+		bool IsHangingPunctuation(StringView grapheme) noexcept
+		{
+			return grapheme == U"、" || grapheme == U"。" || grapheme == U"，" || grapheme == U"．" || grapheme == U"､" || grapheme == U"｡";
+		}
+
+		// 隣り合う2つのクラスだけでは決まらない規則のために、前後の並びから求めておくもの
+		struct Surroundings
+		{
+			ULineBreak beforeA      = U_LB_UNKNOWN; // 直前の書記素の更に1つ前のクラス (LB21a)
+			ULineBreak beforeSpaces = U_LB_UNKNOWN; // 直前の空白を飛ばした所にある書記素のクラス (LB14～17)
+			ULineBreak afterB       = U_LB_UNKNOWN; // 直後の書記素の更に1つ後のクラス (LB25)
+			bool       afterZwj     = false;        // 直前の書記素が ZWJ で終わっている (LB8a)
+			bool       hyphenA      = false;        // 直前の書記素が HY か U+2010 (LB20a)
+			bool       eastAsianA   = false;        // 直前の書記素が東アジアの全角・半角の文字 (LB30)
+			bool       eastAsianB   = false;        // 直後の書記素が東アジアの全角・半角の文字 (LB30)
+			bool       inNumber     = false;        // 直前までが NU (NU|SY|IS)* で終わっている (LB25)
+			bool       closeNumber  = false;        // 直前までが NU (NU|SY|IS)* (CL|CP) で終わっている (LB25)
+		};
+
+		/// @param a 直前の書記素のクラス
+		/// @param b 直後の書記素のクラス
+		bool CanBreakBetween(ULineBreak a, ULineBreak b, const Surroundings& around) noexcept
+		{
+			const ULineBreak beforeSpaces = around.beforeSpaces;
+
+			// LB6, LB7
+			if (IsOneOf(b, U_LB_MANDATORY_BREAK, U_LB_CARRIAGE_RETURN, U_LB_LINE_FEED, U_LB_NEXT_LINE, U_LB_SPACE, U_LB_ZWSPACE)) return false;
+			// LB8
+			if (beforeSpaces == U_LB_ZWSPACE) return true;
+			// LB8a (空白の後ろの ZWJ のように、書記素クラスタの末尾に付いた ZWJ の後ろでも区切らない)
+			if (around.afterZwj) return false;
+			// LB11, LB12
+			if (a == U_LB_WORD_JOINER || b == U_LB_WORD_JOINER || a == U_LB_GLUE) return false;
+			// LB12a
+			if (b == U_LB_GLUE && not IsOneOf(a, U_LB_SPACE, U_LB_BREAK_AFTER, U_LB_HYPHEN)) return false;
+			// LB13
+			if (IsOneOf(b, U_LB_CLOSE_PUNCTUATION, U_LB_CLOSE_PARENTHESIS, U_LB_EXCLAMATION, U_LB_BREAK_SYMBOLS)) return false;
+			// LB14～LB17 (IS の前は、空白の後ろで数字が続く時だけ区切れる)
+			if (beforeSpaces == U_LB_OPEN_PUNCTUATION) return false;
+			if (b == U_LB_INFIX_NUMERIC) return a == U_LB_SPACE && around.afterB == U_LB_NUMERIC;
+			if (beforeSpaces == U_LB_QUOTATION && b == U_LB_OPEN_PUNCTUATION) return false;
+			if (IsOneOf(beforeSpaces, U_LB_CLOSE_PUNCTUATION, U_LB_CLOSE_PARENTHESIS) && b == U_LB_NONSTARTER) return false;
+			if (beforeSpaces == U_LB_BREAK_BOTH && b == U_LB_BREAK_BOTH) return false;
+			// LB18
+			if (a == U_LB_SPACE) return true;
+			// LB19, LB20
+			if (a == U_LB_QUOTATION || b == U_LB_QUOTATION) return false;
+			if (a == U_LB_CONTINGENT_BREAK || b == U_LB_CONTINGENT_BREAK) return true;
+			// LB20a (語頭のハイフン。ICU 72 に合わせて HL の前は含まない)
+			if (around.hyphenA && IsOneOf(around.beforeA, U_LB_UNKNOWN, U_LB_MANDATORY_BREAK, U_LB_CARRIAGE_RETURN, U_LB_LINE_FEED, U_LB_NEXT_LINE, U_LB_SPACE, U_LB_ZWSPACE, U_LB_CONTINGENT_BREAK, U_LB_GLUE) && b == U_LB_ALPHABETIC) return false;
+			// LB21, LB22
+			if (IsOneOf(b, U_LB_BREAK_AFTER, U_LB_HYPHEN, U_LB_NONSTARTER, U_LB_INSEPARABLE) || a == U_LB_BREAK_BEFORE) return false;
+			// LB21a, LB21b
+			if (around.beforeA == U_LB_HEBREW_LETTER && IsOneOf(a, U_LB_HYPHEN, U_LB_BREAK_AFTER)) return false;
+			if (a == U_LB_BREAK_SYMBOLS && b == U_LB_HEBREW_LETTER) return false;
+			// LB23, LB23a, LB24
+			if (IsOneOf(a, U_LB_ALPHABETIC, U_LB_HEBREW_LETTER) && b == U_LB_NUMERIC) return false;
+			if (a == U_LB_NUMERIC && IsOneOf(b, U_LB_ALPHABETIC, U_LB_HEBREW_LETTER)) return false;
+			if (a == U_LB_PREFIX_NUMERIC && IsOneOf(b, U_LB_IDEOGRAPHIC, U_LB_E_BASE, U_LB_E_MODIFIER)) return false;
+			if (IsOneOf(a, U_LB_IDEOGRAPHIC, U_LB_E_BASE, U_LB_E_MODIFIER) && b == U_LB_POSTFIX_NUMERIC) return false;
+			if (IsOneOf(a, U_LB_PREFIX_NUMERIC, U_LB_POSTFIX_NUMERIC) && IsOneOf(b, U_LB_ALPHABETIC, U_LB_HEBREW_LETTER)) return false;
+			if (IsOneOf(a, U_LB_ALPHABETIC, U_LB_HEBREW_LETTER) && IsOneOf(b, U_LB_PREFIX_NUMERIC, U_LB_POSTFIX_NUMERIC)) return false;
+			// LB25 (ICU と同じく、数字列 (PR|PO)? (OP|HY)? NU (NU|SY|IS)* (CL|CP)? (PR|PO)? の中では区切らない)
+			if (IsOneOf(a, U_LB_PREFIX_NUMERIC, U_LB_POSTFIX_NUMERIC) && b == U_LB_NUMERIC) return false;
+			if (IsOneOf(a, U_LB_PREFIX_NUMERIC, U_LB_POSTFIX_NUMERIC) && IsOneOf(b, U_LB_OPEN_PUNCTUATION, U_LB_HYPHEN) && around.afterB == U_LB_NUMERIC) return false;
+			if (IsOneOf(a, U_LB_OPEN_PUNCTUATION, U_LB_HYPHEN, U_LB_INFIX_NUMERIC) && b == U_LB_NUMERIC) return false;
+			if (around.inNumber && IsOneOf(b, U_LB_NUMERIC, U_LB_BREAK_SYMBOLS, U_LB_INFIX_NUMERIC, U_LB_CLOSE_PUNCTUATION, U_LB_CLOSE_PARENTHESIS)) return false;
+			if ((around.inNumber || around.closeNumber) && IsOneOf(b, U_LB_POSTFIX_NUMERIC, U_LB_PREFIX_NUMERIC)) return false;
+			// LB26, LB27
+			if (a == U_LB_JL && IsOneOf(b, U_LB_JL, U_LB_JV, U_LB_H2, U_LB_H3)) return false;
+			if (IsOneOf(a, U_LB_JV, U_LB_H2) && IsOneOf(b, U_LB_JV, U_LB_JT)) return false;
+			if (IsOneOf(a, U_LB_JT, U_LB_H3) && b == U_LB_JT) return false;
+			if (IsOneOf(a, U_LB_JL, U_LB_JV, U_LB_JT, U_LB_H2, U_LB_H3) && b == U_LB_POSTFIX_NUMERIC) return false;
+			if (a == U_LB_PREFIX_NUMERIC && IsOneOf(b, U_LB_JL, U_LB_JV, U_LB_JT, U_LB_H2, U_LB_H3)) return false;
+			// LB28, LB29
+			if (IsOneOf(a, U_LB_ALPHABETIC, U_LB_HEBREW_LETTER) && IsOneOf(b, U_LB_ALPHABETIC, U_LB_HEBREW_LETTER)) return false;
+			if (a == U_LB_INFIX_NUMERIC && IsOneOf(b, U_LB_ALPHABETIC, U_LB_HEBREW_LETTER)) return false;
+			// LB30 (「」のような東アジアの括弧は含まない)
+			if (IsOneOf(a, U_LB_ALPHABETIC, U_LB_HEBREW_LETTER, U_LB_NUMERIC) && b == U_LB_OPEN_PUNCTUATION && not around.eastAsianB) return false;
+			if (a == U_LB_CLOSE_PARENTHESIS && not around.eastAsianA && IsOneOf(b, U_LB_ALPHABETIC, U_LB_HEBREW_LETTER, U_LB_NUMERIC)) return false;
+			// LB30a は書記素クラスタの時点で RI が2つずつ纏まっているので不要
+			// LB30b
+			if (a == U_LB_E_BASE && b == U_LB_E_MODIFIER) return false;
+			// LB31
+			return true;
+		}
+	} // namespace
+
+	LineBreakOpportunities::LineBreakOpportunities(const Array<StringView>& graphemes)
+		: m_size(graphemes.size())
+		, m_breakable((graphemes.size() + 63) / 64, 0)
+		, m_mandatory((graphemes.size() + 63) / 64, 0)
+		, m_hangable((graphemes.size() + 63) / 64, 0)
+		, m_newline((graphemes.size() + 63) / 64, 0)
+	{
+		if (graphemes.isEmpty())
+		{
+			return;
+		}
+
+		const Array<ULineBreak> leading  = graphemes.map(LeadingClass);
+		const Array<ULineBreak> trailing = graphemes.map(TrailingClass);
+
+		Surroundings around = {.beforeSpaces = trailing.front(), .inNumber = (trailing.front() == U_LB_NUMERIC)};
+
+		for (size_t i = 0; i < graphemes.size(); ++i)
+		{
+			const ULineBreak cur = leading[i];
+
+			if (IsOneOf(cur, U_LB_MANDATORY_BREAK, U_LB_CARRIAGE_RETURN, U_LB_LINE_FEED, U_LB_NEXT_LINE))
+			{
+				Set(m_newline, i);
+			}
+
+			if (cur == U_LB_SPACE || IsHangingPunctuation(graphemes[i]))
+			{
+				Set(m_hangable, i);
+			}
+
+			if (i == 0)
+			{
+				continue;
+			}
+
+			const ULineBreak prev = trailing[i - 1];
+
+			around.afterB     = (i + 1 < leading.size() ? leading[i + 1] : U_LB_UNKNOWN);
+			around.afterZwj   = (graphemes[i - 1].back() == U'\u200D');
+			around.hyphenA    = (prev == U_LB_HYPHEN || graphemes[i - 1].front() == U'\u2010');
+			around.eastAsianA = IsEastAsian(graphemes[i - 1]);
+			around.eastAsianB = IsEastAsian(graphemes[i]);
+
+			// LB4, LB5
+			if (IsOneOf(prev, U_LB_MANDATORY_BREAK, U_LB_CARRIAGE_RETURN, U_LB_LINE_FEED, U_LB_NEXT_LINE))
+			{
+				Set(m_mandatory, i);
+				Set(m_breakable, i);
+			}
+			else if (CanBreakBetween(prev, cur, around))
+			{
+				Set(m_breakable, i);
+			}
+
+			// ここから先は、今の書記素を後ろから見たクラスで並びを追う
+			const ULineBreak next = trailing[i];
+
+			if (next != U_LB_SPACE)
+			{
+				around.beforeSpaces = next;
+			}
+
+			around.beforeA     = prev;
+			around.closeNumber = around.inNumber && IsOneOf(next, U_LB_CLOSE_PUNCTUATION, U_LB_CLOSE_PARENTHESIS);
+			around.inNumber    = (next == U_LB_NUMERIC) || (around.inNumber && IsOneOf(next, U_LB_BREAK_SYMBOLS, U_LB_INFIX_NUMERIC));
+		}
+	}
+} // namespace tomolatoon
@@ -0,0 +1,68 @@
+﻿#pragma once
+
+#include <Siv3D.hpp>
+
+namespace tomolatoon
+{
+	// 書記素クラスタ毎の改行可能位置
+	// UAX #14 の規則 (LB4～LB31) に、日本語の禁則 (CJ を NS として扱う strict な行頭禁則と、句読点のぶら下げ) を加えたもの
+	// 数字の並び (LB25) は ICU と同じく (PR|PO)? (OP|HY)? NU (NU|SY|IS)* (CL|CP)? (PR|PO)? として見る
+	// ICU の ja@lb=strict との違い (ListBench の RunLineBreaks で確かめている)
+	// - “” の前後: ICU は ja で QU を独自に扱い、前後で区切る。こちらは UAX #14 のまま区切らない
+	// - 絵文字以外に付いた肌の色 (EM): ICU は前と区切ることがある。こちらは書記素クラスタの中なので区切らない
+	// - 開き括弧と空白の後のハイフン (「( -#」など): ICU は区切る。こちらは LB20a の語頭のハイフンとして区切らない
+	// 文字列毎に一度だけ求めてビット列で持っておき、折り返しはこれを線形に走査するだけで済むようにする
+	struct LineBreakOpportunities
+	{
+		LineBreakOpportunities() = default;
+
+		/// @param graphemes 書記素クラスタ毎に分割した文字列
+		explicit LineBreakOpportunities(const Array<StringView>& graphemes);
+
+		size_t size() const noexcept
+		{
+			return m_size;
+		}
+
+		/// @brief i 番目の書記素の前で改行してよいか
+		bool canBreakBefore(size_t i) const noexcept
+		{
+			return Test(m_breakable, i);
+		}
+
+		/// @brief i 番目の書記素の前で必ず改行するか (前が改行文字)
+		bool mustBreakBefore(size_t i) const noexcept
+		{
+			return Test(m_mandatory, i);
+		}
+
+		/// @brief i 番目の書記素を行末からはみ出させてよいか (句読点のぶら下げ、行末の空白)
+		bool canHang(size_t i) const noexcept
+		{
+			return Test(m_hangable, i);
+		}
+
+		/// @brief i 番目の書記素が改行文字か (描画しない)
+		bool isNewline(size_t i) const noexcept
+		{
+			return Test(m_newline, i);
+		}
+
+	private:
+		static bool Test(const Array<uint64>& bits, size_t i) noexcept
+		{
+			return (i / 64) < bits.size() && ((bits[i / 64] >> (i % 64)) & 1);
+		}
+
+		static void Set(Array<uint64>& bits, size_t i) noexcept
+		{
+			bits[i / 64] |= (uint64{1} << (i % 64));
+		}
+
+		size_t        m_size      = 0;
+		Array<uint64> m_breakable = {};
+		Array<uint64> m_mandatory = {};
+		Array<uint64> m_hangable  = {};
+		Array<uint64> m_newline   = {};
+	};
+} // namespace tomolatoon
@@ -6,7 +6,8 @@
 
 #include "Utility.hpp"
 #include "Units.hpp"
-#include "LerpTransition.hpp"
+#include "Animation.hpp"
+#include "RenderTexturePool.hpp"
 
 namespace tomolatoon
 {
@@ -21,13 +22,121 @@ namespace tomolatoon
 			virtual ~IDrawer() = default;
 		};
 
+		// IDrawer のように描画できる、型消去された描画関数
+		// BufferSize に収まるものはヒープを使わずに内部に持つ
+		struct Drawer
+		{
+			inline static constexpr size_t BufferSize = 32;
+
+			Drawer() noexcept = default;
+
+			template <class Func>
+			requires std::invocable<const Func&, double, double> && (not std::same_as<Func, Drawer>)
+			Drawer(Func func)
+			{
+				if constexpr (sizeof(Func) <= BufferSize && alignof(Func) <= alignof(std::max_align_t) && std::is_nothrow_move_constructible_v<Func>)
+				{
+					new (m_buffer) Func(std::move(func));
+					m_ops = &OpsFor<Func>;
+				}
+				else
+				{
+					// 収まらないものはヒープに置いて、そのポインタを持つ
+					*this = Drawer{[p = std::make_unique<Func>(std::move(func))](double per, double stopTime) { (*p)(per, stopTime); }};
+				}
+			}
+
+			Drawer(std::unique_ptr<IDrawer>&& drawer)
+				: Drawer([p = std::move(drawer)](double per, double stopTime) { p->draw(per, stopTime); })
+			{}
+
+			Drawer(const Drawer&)            = delete;
+			Drawer& operator=(const Drawer&) = delete;
+
+			Drawer(Drawer&& other) noexcept
+				: m_ops(std::exchange(other.m_ops, nullptr))
+			{
+				if (m_ops)
+				{
+					m_ops->move(m_buffer, other.m_buffer);
+				}
+			}
+
+			Drawer& operator=(Drawer&& other) noexcept
+			{
+				if (this != &other)
+				{
+					reset();
+
+					m_ops = std::exchange(other.m_ops, nullptr);
+
+					if (m_ops)
+					{
+						m_ops->move(m_buffer, other.m_buffer);
+					}
+				}
+
+				return *this;
+			}
+
+			~Drawer()
+			{
+				reset();
+			}
+
+			void draw(double per, double stopTime) const
+			{
+				if (m_ops)
+				{
+					m_ops->draw(m_buffer, per, stopTime);
+				}
+			}
+
+			void reset() noexcept
+			{
+				if (m_ops)
+				{
+					m_ops->destroy(m_buffer);
+					m_ops = nullptr;
+				}
+			}
+
+			explicit operator bool() const noexcept
+			{
+				return m_ops != nullptr;
+			}
+
+		private:
+			struct Ops
+			{
+				void (*draw)(const void*, double, double);
+				void (*move)(void* dst, void* src);
+				void (*destroy)(void*);
+			};
+
+			template <class Func>
+			inline static constexpr Ops OpsFor = {
+				[](const void* p, double per, double stopTime) { (*static_cast<const Func*>(p))(per, stopTime); },
+				[](void* dst, void* src) {
+					new (dst) Func(std::move(*static_cast<Func*>(src)));
+					static_cast<Func*>(src)->~Func();
+				},
+				[](void* p) { static_cast<Func*>(p)->~Func(); },
+			};
+
+			const Ops* m_ops = nullptr;
+
+			alignas(std::max_align_t) std::byte m_buffer[BufferSize] = {};
+		};
+
 		struct Id
 		{
 			bool operator==(const Id&) const = default;
 
 			std::strong_ordering operator<=>(const Id&) const = default;
 
-			const size_t id;
+			const size_t id;             // DrawablesDic の中での位置
+			const uint32 generation = 0; // 同じ位置が使い回される度に増える
 		};
 	} // namespace List
 } // namespace tomolatoon
@@ -37,7 +146,7 @@ struct std::hash<tomolatoon::List::Id>
 {
 	size_t operator()(const tomolatoon::List::Id& id) const noexcept
 	{
-		return id.id;
+		return id.id ^ (static_cast<size_t>(id.generation) << 32);
 	}
 };
 
@@ -46,112 +155,127 @@ namespace tomolatoon
 	namespace List
 	{
 		// Drawables の辞書
+		// 世代付きのスロットマップで、Drawer は連続した配列に直接持つ
+		// erase されたスロットは使い回すが、世代が変わるので古い Id では引けない
 		struct DrawablesDic
 		{
-			inline static struct Unavailable final : IDrawer
-			{
-				String name() const override
-				{
-					return U"Unavailable";
-				}
-
-				void draw(double per, double stopTime) const override {}
-			} unavailable;
+			inline static const Drawer unavailable = {};
 
 			size_t size() const noexcept
 			{
-				return m_drawablesDic.size();
+				return m_slots.size() - m_free.size();
 			}
 
-			Id add(std::unique_ptr<IDrawer>&& drawer)
+			/// @brief 次に add した時に使われる Id の id
+			size_t nextIndex() const noexcept
 			{
-				Id id = {m_drawablesDic.size()};
-
-				m_drawablesDic.emplace(id, std::move(drawer));
-
-				return id;
+				return m_free ? m_free.back() : m_slots.size();
 			}
 
-			template <class Lam>
-			requires(not std::indirectly_readable<Lam>)
-			Id add(Lam lam)
+			Id add(Drawer drawer)
 			{
-				struct LambdaWrapper : IDrawer
+				if (m_free)
 				{
-					LambdaWrapper(Lam lam) noexcept
-						: m_lambda(std::move(lam)) {}
+					const size_t index = m_free.back();
+					m_free.pop_back();
 
-					String name() const override
-					{
-						return m_name;
-					}
+					Slot& slot  = m_slots[index];
+					slot.drawer = std::move(drawer);
 
-					void draw(double per, double stopTime) const override
-					{
-						m_lambda(per, stopTime);
-					}
+					return Id{index, slot.generation};
+				}
 
-				private:
-					Lam          m_lambda;
-					const String m_name = U"LambdaWrapper[{}]"_fmt(Scene::Time());
-				};
+				m_slots.push_back(Slot{std::move(drawer), 0});
 
-				return add(std::make_unique<LambdaWrapper>(std::move(lam)));
+				return Id{m_slots.size() - 1, 0};
 			}
 
-			void erase(Id id)
+			Id add(std::unique_ptr<IDrawer>&& drawer)
 			{
-				m_drawablesDic.erase(id);
+				return add(Drawer{std::move(drawer)});
 			}
 
-			bool contains(Id id) const
+			template <class Lam>
+			requires std::invocable<const Lam&, double, double>
+			Id add(Lam lam)
 			{
-				return m_drawablesDic.contains(id);
+				return add(Drawer{std::move(lam)});
 			}
 
-			IDrawer& getById(Id id) noexcept
+			void erase(Id id)
 			{
 				if (contains(id))
 				{
-					return *m_drawablesDic.at(id);
-				}
-				else
-				{
-					return unavailable;
+					Slot& slot = m_slots[id.id];
+					slot.drawer.reset();
+					++slot.generation;
+
+					m_free.push_back(id.id);
 				}
 			}
 
-			const IDrawer& getById(Id id) const noexcept
+			bool contains(Id id) const noexcept
 			{
-				if (contains(id))
-				{
-					return *m_drawablesDic.at(id);
-				}
-				else
-				{
-					return unavailable;
-				}
+				return id.id < m_slots.size() && m_slots[id.id].generation == id.generation;
+			}
+
+			const Drawer& getById(Id id) const noexcept
+			{
+				return contains(id) ? m_slots[id.id].drawer : unavailable;
 			}
 
 		private:
-			HashTable<Id, std::unique_ptr<IDrawer>> m_drawablesDic = {};
+			struct Slot
+			{
+				Drawer drawer;
+				uint32 generation;
+			};
+
+			Array<Slot>   m_slots = {};
+			Array<size_t> m_free  = {};
+		};
+
+		// List が1フレームの間に読む時刻と入力
+		// Scene や MouseL、Cursor を直接読まずにこれを通すことで、ウィンドウ無しでも決まった入力で List を動かせる
+		struct FrameInput
+		{
+			double time         = 0.0;   // Scene::Time()
+			double deltaSec     = 0.0;   // Scene::DeltaTime()
+			bool   pressed      = false; // MouseL.pressed()
+			bool   clicked      = false; // 領域内で左クリックされたか
+			double cursorDeltaY = 0.0;   // Cursor::DeltaF().y
+			double sceneHeight  = 0.0;   // Scene::Height()。カードの高さはここから決まる
+
+			/// @brief 今のフレームの入力を取得する。
+			/// @param region クリックを受け付ける領域
+			static FrameInput Capture(const Rect& region)
+			{
+				return FrameInput{
+					.time         = Scene::Time(),
+					.deltaSec     = Scene::DeltaTime(),
+					.pressed      = MouseL.pressed(),
+					.clicked      = region.leftClicked(),
+					.cursorDeltaY = Cursor::DeltaF().y,
+					.sceneHeight  = static_cast<double>(Scene::Height()),
+				};
+			}
 		};
 
 		// スライダーを掴んでいる状態であるかどうかを示す。isPressed が true なら加速度の計算を行う、のように使用する。
 		struct HoldingState
 		{
-			// 特殊な条件で Rect の一部をドラッグ開始としては無視するときに true にする。
-			bool update(Rect rect, bool isIgnoreWhenStart = false) noexcept
+			// 特殊な条件で領域の一部をドラッグ開始としては無視するときに true にする。
+			bool update(const FrameInput& input, bool isIgnoreWhenStart = false) noexcept
 			{
 				if (m_pressed)
 				{
 					// 前フレームで掴まれていれば、領域外に出ていても押し続けられていればよい
-					m_pressed = MouseL.pressed();
+					m_pressed = input.pressed;
 				}
 				else
 				{
 					// 掴みの開始は領域内から
-					m_pressed = rect.leftClicked() && !isIgnoreWhenStart;
+					m_pressed = input.clicked && !isIgnoreWhenStart;
 				}
 
 				return isPressed();
@@ -180,9 +304,36 @@ namespace tomolatoon
 				Stopping        = 0b01000000, // 完全に止まった時
 			};
 
+			/// @param sceneHeight 最初の画面の高さ。以降は Update が FrameInput::sceneHeight で更新する
+			explicit Context(double sceneHeight) noexcept
+				: m_sceneHeight(sceneHeight)
+			{}
+
 			double cardHeight() const noexcept
 			{
-				return Units::sh(100.0 / 7);
+				return m_sceneHeight / 7;
+			}
+
+			double sceneHeight() const noexcept
+			{
+				return m_sceneHeight;
+			}
+
+			// 画面の高さを変える
+			// カードの高さも変わるので、中央のカードが変わらないように Diff も同じ比率で伸縮する
+			Context& sceneHeight(double sceneHeight) noexcept
+			{
+				if (sceneHeight > 0 && sceneHeight != m_sceneHeight)
+				{
+					const double scale = m_sceneHeight > 0 ? sceneHeight / m_sceneHeight : 1.0;
+
+					m_sceneHeight      = sceneHeight;
+					m_diff            *= scale;
+					m_prevStoppedDiff *= scale;
+					m_prevStepDiff    *= scale;
+				}
+
+				return *this;
 			}
 
 			double cardHeightMax() const noexcept
@@ -190,9 +341,20 @@ namespace tomolatoon
 				return cardHeight() * 1.1;
 			}
 
+			// columns 枚ずつ並べた時の行数
+			size_t rowCount(size_t cardCount) const noexcept
+			{
+				return (cardCount + columns - 1) / columns;
+			}
+
+			size_t rowCount() const noexcept
+			{
+				return rowCount(ary.size());
+			}
+
 			double sliderHeight() const noexcept
 			{
-				return cardHeight() * ary.size();
+				return cardHeight() * rowCount();
 			}
 
 			friend struct CardProp;
@@ -211,11 +373,18 @@ namespace tomolatoon
 					return m_diff;
 				}
 
+				// cur: 中央に存在する行
+				// prev: 前回に止まっていた時の中央に存在する行
+				size_t row() const noexcept
+				{
+					return context.rowCount() - 1 - static_cast<size_t>(m_diff / context.cardHeight());
+				}
+
 				// cur: 中央に存在するカードのインデックス
 				// prev: 前回に止まっていた時の中央に存在するカードのインデックス
 				size_t index() const noexcept
 				{
-					return context.ary.size() - 1 - static_cast<size_t>(m_diff / context.cardHeight());
+					return Min(row() * context.columns + context.selectedColumn, context.ary.size() - 1);
 				}
 
 				// cur:　中央に存在するカードの登録Id
@@ -227,13 +396,7 @@ namespace tomolatoon
 
 				// cur: 中央に存在するカードの描画クラス
 				// prev: 前回に止まっていた時の中央に存在するカードの描画クラス
-				IDrawer& drawer() noexcept
-				requires(not std::is_const_v<Context>)
-				{
-					return context.dic.getById(id());
-				}
-
-				const IDrawer& drawer() const noexcept
+				const Drawer& drawer() const noexcept
 				{
 					return context.dic.getById(id());
 				}
@@ -255,6 +418,33 @@ namespace tomolatoon
 				return CardProp(self, self.m_prevStoppedDiff);
 			}
 
+			// 描画用: 直前の2つの刻みの間を補間した Diff
+			template <class Self>
+			auto rendered(this Self& self) noexcept
+			{
+				// 端を跨いで丸められている時は近い方に向かって補間する
+				double delta = self.m_diff - self.m_prevStepDiff;
+
+				if (Abs(delta) > self.sliderHeight() / 2)
+				{
+					delta -= Sign(delta) * self.sliderHeight();
+				}
+
+				return CardProp(self, modulo(self.m_prevStepDiff + delta * self.m_interpolation, self.sliderHeight()));
+			}
+
+			// 固定刻みで1つ進める前に呼ぶ
+			void beginStep() noexcept
+			{
+				m_prevStepDiff = m_diff;
+			}
+
+			// 最後の刻みから次の刻みまでのどこを描画するか [0, 1]
+			void interpolation(double alpha) noexcept
+			{
+				m_interpolation = Clamp(alpha, 0.0, 1.0);
+			}
+
 			// State 設定を先にやることを推奨
 			Context& diff(double diff) noexcept
 			{
@@ -268,6 +458,91 @@ namespace tomolatoon
 				return *this;
 			}
 
+			// 末尾にカードを追加する
+			// row() は末尾から数えているので、行が増えた時は中央のカードが変わらないように Diff もカード1枚分ずらす
+			Context& append(Id id)
+			{
+				ary.push_back(id);
+
+				if ((ary.size() - 1) % columns == 0)
+				{
+					m_diff            += cardHeight();
+					m_prevStoppedDiff += cardHeight();
+					m_prevStepDiff    += cardHeight();
+				}
+
+				return *this;
+			}
+
+			// カードの並びを newAry に置き換える
+			// 中央のカードと前回止まっていた時のカードがそれぞれ newAry にもあれば、それらが変わらないように Diff と selectedColumn もずらす
+			Context& rearrange(Array<Id> newAry)
+			{
+				if (not ary || not newAry)
+				{
+					ary = std::move(newAry);
+					return *this;
+				}
+
+				// 無くなっていれば、同じ位置にあるカードにする
+				const auto newIndexOf = [&](const auto& prop) {
+					const auto it = std::ranges::find(newAry, prop.id());
+					return it != newAry.end() ? static_cast<size_t>(std::distance(newAry.begin(), it)) : Min(prop.index(), newAry.size() - 1);
+				};
+
+				const auto diffFor = [&](const auto& prop, size_t newIndex) {
+					const double offset = Fmod(Max(prop.diff(), 0.0), cardHeight());
+
+					return (rowCount(newAry.size()) - 1 - newIndex / columns) * cardHeight() + offset;
+				};
+
+				const size_t index           = newIndexOf(cur());
+				const double diff            = diffFor(cur(), index);
+				const double prevStoppedDiff = diffFor(prev(), newIndexOf(prev()));
+
+				ary               = std::move(newAry);
+				m_diff            = diff;
+				m_prevStoppedDiff = prevStoppedDiff;
+				m_prevStepDiff    = diff;
+				selectedColumn    = index % columns;
+
+				return *this;
+			}
+
+			// 1行に並べるカードの枚数を変える (1 ならリスト、2 以上ならグリッド)
+			// 中央のカードが変わらないように Diff と selectedColumn もずらす
+			Context& setColumns(size_t newColumns)
+			{
+				newColumns = Max<size_t>(newColumns, 1);
+
+				const auto diffFor = [&](const auto& prop) {
+					const double offset = Fmod(Max(prop.diff(), 0.0), cardHeight());
+					const size_t rows   = (ary.size() + newColumns - 1) / newColumns;
+
+					return (rows - 1 - prop.index() / newColumns) * cardHeight() + offset;
+				};
+
+				if (ary)
+				{
+					const size_t index           = cur().index();
+					const double diff            = diffFor(cur());
+					const double prevStoppedDiff = diffFor(prev());
+
+					m_diff            = diff;
+					m_prevStoppedDiff = prevStoppedDiff;
+					m_prevStepDiff    = diff;
+					selectedColumn    = index % newColumns;
+				}
+				else
+				{
+					selectedColumn = 0;
+				}
+
+				columns = newColumns;
+
+				return *this;
+			}
+
 			Context& vel(double vel) noexcept
 			{
 				m_vel = Clamp(vel, -VelMax, VelMax);
@@ -281,7 +556,7 @@ namespace tomolatoon
 
 			double stoppingTime() const noexcept
 			{
-				return Scene::Time() - lastStopTime;
+				return now - lastStopTime;
 			}
 
 			double velUnderThreshold() const noexcept
@@ -289,42 +564,97 @@ namespace tomolatoon
 				return 1'000;
 			}
 
-			double deVel() const noexcept
+			// deltaSec の間の速度の変化
+			double deVel(double deltaSec) const noexcept
 			{
 				// 隣に移動するときなどに使いやすいように減速は急に
 				// 遠くまで移動するときはある程度滑るように。
-				if (Abs(vel()) > 2'000)
-				{
-					return -vel() * 0.05;
-				}
-				else
-				{
-					return -vel() * 0.6;
-				}
+				// 減速率は 60fps の1フレームあたりのもので、deltaSec 分に換算する
+				const double rate = Abs(vel()) > 2'000 ? 0.05 : 0.6;
+
+				return -vel() * (1.0 - Pow(1.0 - rate, deltaSec * DeVelReferenceFps));
 			}
 
+		private:
+			double m_sceneHeight = 0.0; // 以下の初期化で使うので先に置く
+
 		public:
-			DrawablesDic   dic              = {};
-			Array<Id>      ary              = {};
-			State          state            = State::ToStoppingFirst;
-			bool           isMouseIgnore    = false;
-			LerpTransition toStoppingDiff   = {0.5s, 0.25s, 0.0, 0.0};
-			LerpTransition toStoppingHeight = {0.05s, 0.05s, cardHeight(), cardHeightMax()};
-			double         lastStopTime     = 0.0;
-			HoldingState   holdingState     = {};
+			DrawablesDic    dic              = {};
+			Array<Id>       ary              = {};
+			State           state            = State::ToStoppingFirst;
+			bool            isMouseIgnore    = false;
+			AnimationSystem animations       = {}; // Update の刻み毎に纏めて進める
+			Animation       toStoppingDiff   = animations.add(0.5s, 0.25s, 0.0, 0.0, EaseOutQuint);
+			Animation       toStoppingHeight = animations.add(0.05s, 0.05s, cardHeight(), cardHeightMax());
+			double          lastStopTime     = 0.0;
+			double          now              = 0.0; // 最後に update した時の時刻
+			HoldingState    holdingState     = {};
+			size_t          columns          = 1; // 1行に並べるカードの枚数。変える時は setColumns を使う
+			size_t          selectedColumn   = 0; // 中央の行のうち、選択しているカードの列
 
 		public:
-			inline static constexpr double VelMax = 100'000;
+			inline static constexpr double VelMax            = 100'000;
+			inline static constexpr double DeVelReferenceFps = 60.0;
 
 		private:
 			double m_diff            = modulo(-cardHeight() / 2, sliderHeight());
 			double m_prevStoppedDiff = modulo(-cardHeight() / 2, sliderHeight());
+			double m_prevStepDiff    = modulo(-cardHeight() / 2, sliderHeight());
+			double m_interpolation   = 1.0;
 			double m_vel             = 0;
 		}; // namespace List
 
+		// 物理は固定の刻み幅で進め、描画は直前の2つの刻みの間を補間する
+		// フレームレートが違っても、重いフレームがあっても同じ動きになる
 		struct Update
 		{
+			// 刻み幅[s]
+			inline static constexpr double StepSec = 1.0 / 240;
+
+			// 1フレームで進める刻みの最大数。これを超えた分は捨てて、重いフレームの後に一気に飛ばないようにする
+			inline static constexpr int32 MaxStepsPerFrame = 24;
+
 			Id update(Context& context)
+			{
+				return update(context, FrameInput::Capture(Iframe::Rect()));
+			}
+
+			Id update(Context& context, const FrameInput& input)
+			{
+				context.now = input.time;
+				context.sceneHeight(input.sceneHeight);
+				context.animations.setRange(context.toStoppingHeight, context.cardHeight(), context.cardHeightMax());
+
+				// 掴んでいる間は刻みに関係なくカーソルにそのまま付いていく
+				const bool isHeld = context.holdingState.update(input, context.isMouseIgnore);
+
+				if (isHeld)
+				{
+					context.state = Context::State::MouseHandled;
+
+					if (input.deltaSec > 0)
+					{
+						context.vel(input.cursorDeltaY / input.deltaSec);
+					}
+
+					context.beginStep();
+					context.diff(modulo(context.cur().diff() + input.cursorDeltaY, context.sliderHeight()));
+				}
+
+				m_accumulatedSec = Min(m_accumulatedSec + input.deltaSec, StepSec * MaxStepsPerFrame);
+
+				for (; m_accumulatedSec >= StepSec; m_accumulatedSec -= StepSec)
+				{
+					step(context, isHeld);
+				}
+
+				context.interpolation(isHeld ? 1.0 : m_accumulatedSec / StepSec);
+
+				return context.cur().id();
+			}
+
+		private:
+			void step(Context& context, bool isHeld)
 			{
 				using State = Context::State;
 
@@ -333,18 +663,12 @@ namespace tomolatoon
 					return modulo(fp, context.sliderHeight());
 				};
 
-				context.toStoppingHeight.setRange(context.cardHeight(), context.cardHeightMax());
-
 				// state 更新
-				if (context.holdingState.update(Iframe::Rect(), context.isMouseIgnore))
-				{
-					context.state = Context::State::MouseHandled;
-				}
-				else
+				if (not isHeld)
 				{
 					if (Abs(context.vel()) < context.velUnderThreshold())
 					{
-						if (context.toStoppingHeight.isFinish())
+						if (context.animations.isFinish(context.toStoppingHeight))
 						{
 							if (context.state != State::StoppingFirst && context.state != State::Stopping)
 							{
@@ -378,26 +702,23 @@ namespace tomolatoon
 				{
 					using enum State;
 				case MouseHandled:
-				{
-					context.vel(Cursor::DeltaF().y / Scene::DeltaTime());
-				}
-				break;
+					break;
 				case Coasting:
 				{
-					context.vel(context.vel() + context.deVel());
+					context.vel(context.vel() + context.deVel(StepSec));
 				}
 				break;
 				case ToStoppingFirst:
 				{
-					context.toStoppingDiff.setRange(context.cur().diff(), rounding((context.ary.size() - 1 - context.cur().index()) * context.cardHeight() + (double)(context.cardHeight()) / 2));
-					context.lastStopTime = Scene::Time();
+					context.animations.setRange(context.toStoppingDiff, context.cur().diff(), rounding((context.rowCount() - 1 - context.cur().row()) * context.cardHeight() + (double)(context.cardHeight()) / 2));
+					context.lastStopTime = context.now;
 					context.vel(0);
 				}
 					[[fallthrough]];
 				case ToStopping:
 				{
-					context.toStoppingDiff.updateByDeltaSec(true);
-					context.toStoppingHeight.updateByDeltaSec(true);
+					context.animations.drive(context.toStoppingDiff, true);
+					context.animations.drive(context.toStoppingHeight, true);
 				}
 				break;
 				case StoppingFirst:
@@ -407,31 +728,187 @@ namespace tomolatoon
 
 				if (context.state & ~(State::ToStoppingFirst | State::ToStopping))
 				{
-					context.toStoppingDiff.setRange(0.0, 0.0);
-					context.toStoppingDiff.updateByDeltaSec(false, 1.0);
+					context.animations.setRange(context.toStoppingDiff, 0.0, 0.0);
+					context.animations.drive(context.toStoppingDiff, false);
+					context.animations.jumpToStart(context.toStoppingDiff);
 				}
 
 				if (context.state & ~(State::ToStoppingFirst | State::ToStopping | State::StoppingFirst | State::Stopping))
 				{
-					context.toStoppingHeight.updateByDeltaSec(false);
+					context.animations.drive(context.toStoppingHeight, false);
 				}
 
-				// 実際に真ん中に据えるカード分の座標差
-				context.diff(rounding(context.cur().diff() + context.vel() * Scene::DeltaTime() + context.toStoppingDiff.deltaValue(EaseOutQuint)));
+				context.animations.update(StepSec);
 
-				return context.cur().id();
+				context.beginStep();
+
+				// 実際に真ん中に据えるカード分の座標差 (掴んでいる間はフレーム毎に動かしている)
+				if (not isHeld)
+				{
+					context.diff(rounding(context.cur().diff() + context.vel() * StepSec + context.animations.deltaValue(context.toStoppingDiff)));
+				}
 			}
+
+			double m_accumulatedSec = 0.0;
+		};
+
+		// 中央以外のカードの見た目をアトラスに焼き付けておくキャッシュ
+		// 中央以外のカードは per = 0.0 で描画され内容がほとんど変わらないので、1度描画したものを1枚の矩形として使い回す
+		// カードの大きさが変わったらアトラスごと作り直す。カードの内容が変わった時は invalidate() を呼ぶ
+		struct ImpostorAtlas
+		{
+			inline static constexpr int32 MaxAtlasWidth = 8192;
+
+			/// @param pool アトラスはここから借りる
+			explicit ImpostorAtlas(RenderTexturePool& pool, size_t slotCount = 16) noexcept
+				: m_pool(pool)
+				, m_slotCount(Max<size_t>(slotCount, 1))
+			{}
+
+			/// @brief スロットを slotCount 個以上にする。増やす時はアトラスを作り直す
+			/// 1画面に見える中央以外のカードの枚数より多くしておかないと、毎フレーム焼き直すことになる
+			void reserve(size_t slotCount)
+			{
+				if (slotCount > m_slotCount)
+				{
+					m_slotCount = slotCount;
+					clear();
+				}
+			}
+
+			/// @brief id のカードを rect に描画する。焼き付けられなければそのまま描画する
+			void draw(Id id, const Rect& rect, const Drawer& drawer, double stopTime)
+			{
+				if (const auto impostor = get(id, rect.size, drawer, stopTime))
+				{
+					const ScopedRenderStates2D blend{BlendState::Premultiplied};
+					impostor->draw(rect.tl());
+				}
+				else
+				{
+					ScopedIframe2D iframe(rect, ScopedIframe2DCropped::No);
+					drawer.draw(0.0, stopTime);
+				}
+			}
+
+			/// @brief id のカードの見た目を取得する。焼き付けていなければ drawer で描画して焼き付ける。
+			/// @return カードが大きすぎてアトラスに収まらない時は none
+			Optional<TextureRegion> get(Id id, Size cardSize, const Drawer& drawer, double stopTime)
+			{
+				if (cardSize != m_cardSize)
+				{
+					rebuild(cardSize);
+				}
+
+				if (not m_atlas)
+				{
+					return none;
+				}
+
+				++m_clock;
+
+				if (auto it = m_slotOf.find(id); it != m_slotOf.end())
+				{
+					m_slots[it->second].lastUsed = m_clock;
+					return (*m_atlas)(slotRect(it->second));
+				}
+
+				// 空いているか、最も古く使われたスロットに焼き付ける
+				const size_t slot = std::ranges::min_element(m_slots, {}, [](const Slot& s) { return s.id ? s.lastUsed : 0; }) - m_slots.begin();
+
+				if (m_slots[slot].id)
+				{
+					m_slotOf.erase(*m_slots[slot].id);
+				}
+
+				m_slots[slot].id.emplace(id);
+				m_slots[slot].lastUsed = m_clock;
+				m_slotOf.emplace(id, slot);
+
+				{
+					const ScopedOffscreen2D offscreen{*m_atlas, slotRect(slot)};
+					drawer.draw(0.0, stopTime);
+				}
+
+				return (*m_atlas)(slotRect(slot));
+			}
+
+			void invalidate(Id id)
+			{
+				if (auto it = m_slotOf.find(id); it != m_slotOf.end())
+				{
+					m_slots[it->second].id.reset();
+					m_slotOf.erase(it);
+				}
+			}
+
+			/// @brief アトラスをプールに返す
+			void clear()
+			{
+				m_atlas.release();
+				m_cardSize = {};
+				m_slots.clear();
+				m_slotOf.clear();
+			}
+
+		private:
+			struct Slot
+			{
+				Optional<Id> id       = none;
+				uint64       lastUsed = 0;
+			};
+
+			int32 columns() const noexcept
+			{
+				return MaxAtlasWidth / Max(m_cardSize.x, 1);
+			}
+
+			Rect slotRect(size_t slot) const noexcept
+			{
+				return Rect{static_cast<int32>(slot % columns()) * m_cardSize.x, static_cast<int32>(slot / columns()) * m_cardSize.y, m_cardSize};
+			}
+
+			void rebuild(Size cardSize)
+			{
+				clear();
+
+				m_cardSize = cardSize;
+
+				if (cardSize.x <= 0 || cardSize.y <= 0 || columns() == 0)
+				{
+					return;
+				}
+
+				const int32 columns = Min(this->columns(), static_cast<int32>(m_slotCount));
+				const int32 rows    = static_cast<int32>((m_slotCount + columns - 1) / columns);
+
+				m_atlas = m_pool.acquire(Size{columns * cardSize.x, rows * cardSize.y});
+				m_slots.resize(m_slotCount);
+			}
+
+			RenderTexturePool&       m_pool;
+			size_t                   m_slotCount = 16;
+			RenderTexturePool::Lease m_atlas     = {};
+			Size                     m_cardSize  = {};
+			Array<Slot>              m_slots     = {};
+			HashTable<Id, size_t>    m_slotOf    = {};
+			uint64                   m_clock     = 0;
 		};
 
 		struct Draw
 		{
+			/// @param pool 中央以外のカードを焼き付けるアトラスはここから借りる
+			explicit Draw(RenderTexturePool& pool) noexcept
+				: m_impostors(pool)
+			{}
+
 			void draw(const Context& context) const
 			{
 				// startIndex の描画を開始する位置(y座標)
-				const double startY = Scene::CenterF().y + Fmod(context.cur().diff() - 1, context.cardHeight()) - context.cardHeight() - (context.toStoppingHeight.value() - context.cardHeight()) / 2;
+				const double startY = Scene::CenterF().y + Fmod(context.rendered().diff() - 1, context.cardHeight()) - context.cardHeight() - (context.animations.value(context.toStoppingHeight) - context.cardHeight()) / 2;
 
 				// startIndex の描画位置(Rect)
-				const Rect startRect = RectF{0.0, startY, Iframe::Width(), context.toStoppingHeight.value()}.asRect();
+				const Rect startRect = RectF{0.0, startY, Iframe::Width(), context.animations.value(context.toStoppingHeight)}.asRect();
 
 				// [0, context.ary.size()) に丸めながら増減させる
 				const auto inc = [&](int32 index) { return index + 1 >= (int32)(context.ary.size()) ? 0 : index + 1; };
@@ -440,34 +917,123 @@ namespace tomolatoon
 				// 中央のカード
 				{
 					ScopedIframe2D iframe(startRect);
-					context.cur().drawer().draw(context.toStoppingDiff.transition(EaseOutQuint), context.stoppingTime());
+					context.rendered().drawer().draw(context.animations.transition(context.toStoppingDiff), context.stoppingTime());
 				}
 
 				// 上半分のカードたち
 				{
-					int32 index = dec(context.cur().index());
+					int32 index = dec(context.rendered().index());
 					Rect  rect  = RectF{startRect.tl().movedBy(0, -context.cardHeight()), Iframe::Width(), context.cardHeight()}.asRect();
 
 					// bl は実際の領域よりも下方向に 1px はみ出していると考えられるので 0 は含まないでおく
 					for (; rect.bottomY() > 0; rect.moveBy(0, -context.cardHeight()), index = dec(index))
 					{
-						ScopedIframe2D iframe(rect, ScopedIframe2DCropped::No);
-						context.dic.getById(context.ary[index]).draw(0.0, context.stoppingTime());
+						drawSide(context, context.ary[index], rect);
 					}
 				}
 
 				// 下半分のカードたち
 				{
-					int32 index = inc(context.cur().index());
+					int32 index = inc(context.rendered().index());
 					Rect  rect  = RectF{startRect.bl(), Iframe::Width(), context.cardHeight()}.asRect();
 
 					for (; rect.topY() < Iframe::Height(); rect.moveBy(0, context.cardHeight()), index = inc(index))
 					{
-						ScopedIframe2D iframe(rect, ScopedIframe2DCropped::No);
-						context.dic.getById(context.ary[index]).draw(0.0, context.stoppingTime());
+						drawSide(context, context.ary[index], rect);
+					}
+				}
+			}
+
+			/// @brief id のカードの見た目が変わった時に呼ぶ
+			void invalidate(Id id)
+			{
+				m_impostors.invalidate(id);
+			}
+
+			void clear()
+			{
+				m_impostors.clear();
+			}
+
+		private:
+			// 中央以外のカードは焼き付けたものを描画する
+			void drawSide(const Context& context, Id id, const Rect& rect) const
+			{
+				m_impostors.draw(id, rect, context.dic.getById(id), context.stoppingTime());
+			}
+
+			mutable ImpostorAtlas m_impostors;
+		};
+
+		// context.columns 枚ずつ並べたグリッドとして描画する
+		// 物理は List::Update をそのまま使い、1行を1枚のカードとして動かす
+		// 見えている行の範囲は Diff から直接求め、見えているセルの描画クラスだけを呼ぶ
+		struct GridDraw
+		{
+			/// @param pool セルを焼き付けるアトラスはここから借りる
+			explicit GridDraw(RenderTexturePool& pool) noexcept
+				: m_impostors(pool)
+			{}
+
+			void draw(const Context& context) const
+			{
+				const auto   center     = context.rendered();
+				const double cardHeight = context.cardHeight();
+				const int32  cellWidth  = Iframe::Width() / static_cast<int32>(context.columns);
+
+				// 中央の行の描画を開始する位置(y座標)
+				const double startY = Scene::CenterF().y + Fmod(center.diff() - 1, cardHeight) - cardHeight;
+
+				// 中央の行より上と下に見えている行の数
+				const int32 above = static_cast<int32>(Ceil(startY / cardHeight));
+				const int32 below = static_cast<int32>(Ceil((Iframe::Height() - startY) / cardHeight));
+
+				m_impostors.reserve(context.columns * (above + below));
+
+				for (int32 k = -above; k < below; ++k)
+				{
+					const int64  rows = static_cast<int64>(context.rowCount());
+					const size_t row  = static_cast<size_t>(((static_cast<int64>(center.row()) + k) % rows + rows) % rows);
+					const int32  y   = static_cast<int32>(startY + cardHeight * k);
+
+					for (size_t column = 0; column < context.columns; ++column)
+					{
+						const size_t index = row * context.columns + column;
+
+						if (index >= context.ary.size())
+						{
+							break;
+						}
+
+						const Id   id   = context.ary[index];
+						const Rect rect = {cellWidth * static_cast<int32>(column), y, cellWidth, static_cast<int32>(cardHeight)};
+
+						if (k == 0 && index == center.index())
+						{
+							ScopedIframe2D iframe(rect, ScopedIframe2DCropped::No);
+							context.dic.getById(id).draw(context.animations.transition(context.toStoppingDiff), context.stoppingTime());
+						}
+						else
+						{
+							m_impostors.draw(id, rect, context.dic.getById(id), context.stoppingTime());
+						}
 					}
 				}
 			}
+
+			/// @brief id のカードの見た目が変わった時に呼ぶ
+			void invalidate(Id id)
+			{
+				m_impostors.invalidate(id);
+			}
+
+			void clear()
+			{
+				m_impostors.clear();
+			}
+
+		private:
+			mutable ImpostorAtlas m_impostors;
 		};
 
 	} // namespace List
@@ -1,18 +1,142 @@
 ﻿#include "Load.hpp"
+#include "CatalogCache.hpp"
 
 namespace tomolatoon
 {
-	Array<Game> InitialLoad() noexcept
+	namespace
 	{
-		JSON          settings;
-		JSONValidator validator;
+		constexpr FilePathView SchemaPath = U"./data.schema.json";
 
-		Array<Game> games;
+		constexpr StringView InitializationErrorTitle = U"KTPC Launcher Initialization Error";
 
+		/// @brief jsonPath のゲームのデータを読み込む。JSON も JSON Schema も前回から変わっていなければキャッシュから作る。
+		/// ワーカースレッドから読み直しにも使うので、ここではメッセージボックスを出さない
+		/// @param error 読み込めなかった場合に、その理由が入る
+		/// @param onBatch Game を CatalogStream::BatchSize 個作る毎に、(games, begin, count) で呼ばれる。games の長さは最初から全体の数になっている
+		/// @return 読み込めなかった場合は none。途中のゲームで失敗した場合も none だが、それまでの onBatch は呼ばれている
+		template <class OnBatch>
+		Optional<Array<Game>> LoadGames(const std::filesystem::path& jsonPath, String& error, OnBatch onBatch)
+		{
+			const auto forEachBatch = [](size_t size, auto&& f) {
+				for (size_t begin = 0; begin < size; begin += CatalogStream::BatchSize)
+				{
+					if (not f(begin, Min(CatalogStream::BatchSize, size - begin)))
+					{
+						return false;
+					}
+				}
+
+				return true;
+			};
+
+			JSON          settings;
+			JSONValidator validator;
+
+			const FilePath         cachePath  = CatalogCache::PathFor(String{jsonPath.u32string()});
+			const Optional<uint64> sourceHash = CatalogCache::HashSources(String{jsonPath.u32string()}, SchemaPath);
+
+			if (auto cached = sourceHash ? CatalogCache::Load(cachePath, *sourceHash) : none)
+			{
+				forEachBatch(cached->size(), [&](size_t begin, size_t count) {
+					onBatch(*cached, begin, count);
+					return true;
+				});
+
+				return cached;
+			}
+
+			if ((validator = JSONValidator::Load(SchemaPath)).isEmpty())
+			{
+				error = U"規定の JSON Schema ファイルが実行ファイルと同じディレクトリに data.schema.json という名前で配置されていませんでした。";
+				return none;
+			}
+
+			settings = JSON::Load(jsonPath.u32string());
+
+			if (not settings)
+			{
+				error = U"ファイル（{}）を JSON として読み込めませんでした。"_fmt(jsonPath.u32string());
+				return none;
+			}
+
+			JSONValidator::ValidationError res;
+
+			if (validator.validate(settings, res); res.isError())
+			{
+				error = U"ファイルは存在しましたが、規定の JSON Schema に沿った JSON データではありませんでした。規定の JSON Schema に従う形で作成してください。エラーメッセージは次に示す通りです。\n{}"_fmt(Format(res));
+				return none;
+			}
+
+			// Game の構築は他のゲームに依存しないので並列に行う
+			// 全て作り終わるのを待たず、BatchSize 個作る毎に onBatch に渡す
+			const JSON  items = settings[U"games"];
+			Array<Game> games(items.size());
+
+			const bool built = forEachBatch(games.size(), [&](size_t begin, size_t count) {
+				const auto errors = ParallelFor(count, [&](size_t i) {
+					games[begin + i] = Game{items[begin + i], jsonPath};
+				});
+
+				if (errors)
+				{
+					error = U"{} 番目のゲームのデータを読み込めませんでした。\n{}"_fmt(begin + errors.front().index, errors.front().message());
+					return false;
+				}
+
+				onBatch(games, begin, count);
+				return true;
+			});
+
+			if (not built)
+			{
+				return none;
+			}
+
+			if (sourceHash)
+			{
+				CatalogCache::Save(cachePath, *sourceHash, games);
+			}
+
+			return games;
+		}
+
+		/// @brief games[begin, begin + count) のアイコンを並列にデコードして progress.decodedIcons に積む。
+		/// @param isLoaded アイコンのパスと更新日時を受け取り、そのアイコンが既に登録済みなら true を返す関数。true ならデコードしない
+		template <class IsLoaded>
+		void DecodeIcons(Array<Game>& games, size_t begin, size_t count, LoadProgress& progress, IsLoaded isLoaded)
+		{
+			const auto errors = ParallelFor(count, [&](size_t i) {
+				Game& game = games[begin + i];
+
+				game.iconWriteTime = FileSystem::WriteTime(game.iconPath);
+
+				if (not isLoaded(game.iconPath, game.iconWriteTime))
+				{
+					progress.decodedIcons.push(DecodedIcon{game.iconAssetName(), game.iconPath, Image{game.iconPath}});
+				}
+
+				++progress.iconsDecoded;
+			});
+
+			// デコード出来なかったアイコンは、パスからの読み込みに任せる
+			for (auto&& error : errors)
+			{
+				const Game& game = games[begin + error.index];
+
+				Logger << U"アイコン（{}）をデコード出来ませんでした: {}"_fmt(game.iconPath, error.message());
+
+				progress.decodedIcons.push(DecodedIcon{game.iconAssetName(), game.iconPath, Image{}});
+				++progress.iconsDecoded;
+			}
+		}
+	} // namespace
+
+	void InitialLoad(LoadProgress& progress) noexcept
+	{
 		do {
-			if ((validator = JSONValidator::Load(U"./data.schema.json")).isEmpty())
+			if (not FileSystem::IsFile(SchemaPath))
 			{
-				System::MessageBoxOK(U"KTPC Launcher Initialization Error", U"規定の JSON Schema ファイルが実行ファイルと同じディレクトリに data.schema.json という名前で配置されていませんでした。");
+				System::MessageBoxOK(InitializationErrorTitle, U"規定の JSON Schema ファイルが実行ファイルと同じディレクトリに data.schema.json という名前で配置されていませんでした。");
 				break;
 			}
 
@@ -20,7 +144,7 @@ namespace tomolatoon
 
 			if (args.size() <= 1)
 			{
-				System::MessageBoxOK(U"KTPC Launcher Initialization Error", U"ゲームについてのデータを提供して下さい。ゲームについてのデータは JSON 形式で、拡張子は .json とし、規定の JSON Schema に従う形で作成し、その JSON へのパスをコマンドライン引数に指定してください。");
+				System::MessageBoxOK(InitializationErrorTitle, U"ゲームについてのデータを提供して下さい。ゲームについてのデータは JSON 形式で、拡張子は .json とし、規定の JSON Schema に従う形で作成し、その JSON へのパスをコマンドライン引数に指定してください。");
 				break;
 			}
 
@@ -28,34 +152,157 @@ namespace tomolatoon
 
 			if (!(jsonPath.extension() == U".json"))
 			{
-				System::MessageBoxOK(U"KTPC Launcher Initialization Error", U"コマンドライン引数にパス（{}）が渡されましたが、拡張子が JSON ではありませんでした。ゲームについてのデータは JSON 形式で、拡張子は .json とし、規定の JSON Schema に従う形で作成してください。"_fmt(jsonPath.u32string()));
+				System::MessageBoxOK(InitializationErrorTitle, U"コマンドライン引数にパス（{}）が渡されましたが、拡張子が JSON ではありませんでした。ゲームについてのデータは JSON 形式で、拡張子は .json とし、規定の JSON Schema に従う形で作成してください。"_fmt(jsonPath.u32string()));
 				break;
 			}
 			else if (!std::filesystem::exists(jsonPath))
 			{
-				System::MessageBoxOK(U"KTPC Launcher Initialization Error", U"コマンドライン引数にパス（{}）が渡されましたが、そのパスに該当するファイルが存在しませんでした。ゲームについてのデータは JSON 形式で、拡張子は .json とし、規定の JSON Schema に従う形で作成してください。"_fmt(jsonPath.u32string()));
+				System::MessageBoxOK(InitializationErrorTitle, U"コマンドライン引数にパス（{}）が渡されましたが、そのパスに該当するファイルが存在しませんでした。ゲームについてのデータは JSON 形式で、拡張子は .json とし、規定の JSON Schema に従う形で作成してください。"_fmt(jsonPath.u32string()));
 				break;
 			}
-			else
+
+			String error;
+
+			// BatchSize 個作る毎にアイコンをデコードし、終わったものから渡していく
+			// 全て作り終わった後にキャッシュへ保存するので、games からは動かさずに複製して渡す
+			const auto loaded = LoadGames(jsonPath, error, [&](Array<Game>& games, size_t begin, size_t count) {
+				progress.iconsTotal = games.size();
+
+				DecodeIcons(games, begin, count, progress, [](auto&&...) { return false; });
+
+				// アイコンを先に積んでおくことで、受け取ったゲームのアイコンが未だ積まれていないということが無いようにする
+				progress.loadedGames.push(Array<Game>(games.begin() + begin, games.begin() + begin + count));
+			});
+
+			if (not loaded)
 			{
-				settings = JSON::Load(jsonPath.u32string());
+				System::MessageBoxOK(InitializationErrorTitle, error);
+				break;
 			}
 
-			JSONValidator::ValidationError res;
+			progress.jsonPath = String{jsonPath.u32string()};
+		} while (false);
+	}
 
-			if (validator.validate(settings, res); res.isError())
+	size_t UploadDecodedIcons(LoadProgress& progress)
+	{
+		Array<DecodedIcon> icons = progress.decodedIcons.takeAll();
+
+		for (auto&& icon : icons)
+		{
+			if (TextureAsset::IsRegistered(icon.name))
 			{
-				System::MessageBoxOK(U"KTPC Launcher Initialization Error", U"ファイルは存在しましたが、規定の JSON Schema に沿った JSON データではありませんでした。規定の JSON Schema に従う形で作成してください。エラーメッセージは次に示す通りです。\n{}"_fmt(Format(res)));
-				break;
+				TextureAsset::Unregister(icon.name);
+			}
+
+			// デコードに失敗したものは、パスからの読み込みに任せる
+			if (not icon.image)
+			{
+				TextureAsset::Register(icon.name, icon.path);
+				continue;
+			}
+
+			auto data = std::make_unique<TextureAssetData>(icon.path);
+
+			// 解放後に再度読み込まれた時はパスからの読み込みに戻す
+			data->onLoad = [image = std::make_shared<Image>(std::move(icon.image))](TextureAssetData& asset, const String& hint) {
+				if (not *image)
+				{
+					return TextureAssetData::DefaultLoad(asset, hint);
+				}
+
+				asset.texture = Texture{*image, asset.desc};
+				image->release();
+
+				return static_cast<bool>(asset.texture);
+			};
+
+			TextureAsset::Register(icon.name, std::move(data));
+			TextureAsset::Load(icon.name);
+		}
+
+		progress.iconsUploaded += icons.size();
+
+		return icons.size();
+	}
+
+	CatalogStream::CatalogStream()
+		: m_task{[this]() { InitialLoad(m_progress); }}
+	{}
+
+	Array<Game> CatalogStream::poll()
+	{
+		// isReady になった時点で全て積まれているので、先に確認してから取り出す
+		const bool isReady = m_task.isReady();
+
+		// ゲームを先に取り出せば、そのアイコンは必ずこの後の UploadDecodedIcons で登録される
+		Array<Game> games = m_progress.loadedGames.takeAll();
+
+		UploadDecodedIcons(m_progress);
+
+		if (isReady)
+		{
+			m_task.get();
+			m_finished = true;
+		}
+
+		return games;
+	}
+
+	CatalogWatcher::CatalogWatcher(FilePathView jsonPath)
+		: m_jsonPath(FileSystem::FullPath(jsonPath))
+		, m_watcher(FileSystem::ParentPath(m_jsonPath))
+	{}
+
+	bool CatalogWatcher::isChanged()
+	{
+		for (auto&& change : m_watcher.retrieveChanges())
+		{
+			if (FileSystem::FullPath(change.path) == m_jsonPath)
+			{
+				m_isDirty = true;
+			}
+		}
+
+		// 読み直し中に書き換えられた分は、読み直しが終わってからもう一度読み直す
+		return m_isDirty && not m_task.isValid();
+	}
+
+	void CatalogWatcher::reload(IconSnapshot loadedIcons)
+	{
+		m_isDirty = false;
+
+		m_task = Async([this, loadedIcons = std::move(loadedIcons)]() -> Optional<Array<Game>> {
+			String error;
+			auto   games = LoadGames(std::filesystem::path{m_jsonPath.toUTF32()}, error, [](auto&&...) {});
+
+			// 保存途中の JSON を読んでしまうこともあるので、読み直しに失敗しても知らせず、今のゲームのままにする
+			if (not games)
+			{
+				Logger << U"JSON の読み直しに失敗しました: {}"_fmt(error);
 			}
 			else
 			{
-				std::ranges::for_each(settings[U"games"], [&](auto&& item) {
-					auto&& [key, game] = item;
-					games.push_back(Game{game, jsonPath});
+				DecodeIcons(*games, 0, games->size(), m_progress, [&](const FilePath& path, const Optional<DateTime>& writeTime) {
+					auto it = loadedIcons.find(path);
+					return it != loadedIcons.end() && it->second == writeTime;
 				});
 			}
-		} while (false);
+
+			return games;
+		});
+	}
+
+	Optional<Array<Game>> CatalogWatcher::poll()
+	{
+		if (not m_task.isReady())
+		{
+			return none;
+		}
+
+		auto games = m_task.get();
+
+		UploadDecodedIcons(m_progress);
 
 		return games;
 	}
@@ -6,8 +6,106 @@
 #include <filesystem>
 
 #include "DataTypes.hpp"
+#include "ConcurrentQueue.hpp"
 
 namespace tomolatoon
 {
-	Array<Game> InitialLoad() noexcept;
-}
+	// ワーカースレッドでデコードされ、メインスレッドでのアップロードを待っているアイコン
+	struct DecodedIcon
+	{
+		AssetName name;
+		FilePath  path;
+		Image     image;
+	};
+
+	// InitialLoad の進捗。InitialLoad を実行しているスレッドと、メインスレッドとで共有する
+	struct LoadProgress
+	{
+		std::atomic<size_t> iconsTotal    = 0;
+		std::atomic<size_t> iconsDecoded  = 0;
+		std::atomic<size_t> iconsUploaded = 0;
+
+		ConcurrentQueue<DecodedIcon> decodedIcons = {};
+		ConcurrentQueue<Game>        loadedGames  = {};
+
+		// 読み込んだ JSON のパス。読み込みが終わるまで読まないこと
+		FilePath jsonPath = {};
+	};
+
+	/// @brief ゲームのデータを読み込み、アイコンをワーカースレッドで並列にデコードする。
+	/// BatchSize 個ずつ、ゲームを作ってアイコンをデコードし終わる度に、アイコンを progress.decodedIcons に、そのゲームを progress.loadedGames に積んでいく。
+	/// 最初の BatchSize 個は、残りのゲームを作るのを待たずに積まれる。
+	void InitialLoad(LoadProgress& progress) noexcept;
+
+	/// @brief progress に溜まっているデコード済みのアイコンを Texture にして TextureAsset に登録する。メインスレッドから呼ぶこと。
+	/// @return 登録したアイコンの数
+	size_t UploadDecodedIcons(LoadProgress& progress);
+
+	// InitialLoad を別スレッドで実行し、読み込めたゲームから少しずつ受け取る
+	// シーンを跨いで読み込みを続けるため、シーンではなく共有データに持たせる
+	struct CatalogStream
+	{
+		// 1度に受け渡すゲームの数
+		inline static constexpr size_t BatchSize = 16;
+
+		CatalogStream();
+
+		CatalogStream(const CatalogStream&)            = delete;
+		CatalogStream& operator=(const CatalogStream&) = delete;
+
+		/// @brief 読み込めたゲームを受け取る。受け取ったゲームのアイコンは Texture にして登録済み。メインスレッドから毎フレーム呼ぶこと。
+		[[nodiscard]] Array<Game> poll();
+
+		/// @brief 全てのゲームを受け取り終わったか
+		bool isFinished() const noexcept
+		{
+			return m_finished;
+		}
+
+		const LoadProgress& progress() const noexcept
+		{
+			return m_progress;
+		}
+
+		/// @brief 読み込んだ JSON のパス。読み込みに失敗した場合は空。isFinished になるまでは空
+		FilePathView jsonPath() const noexcept
+		{
+			return m_finished ? FilePathView{m_progress.jsonPath} : FilePathView{};
+		}
+
+	private:
+		LoadProgress    m_progress;
+		bool            m_finished = false;
+		AsyncTask<void> m_task;
+	};
+
+	// 登録済みのアイコンのパスと、その時の更新日時
+	using IconSnapshot = HashTable<FilePath, Optional<DateTime>>;
+
+	// JSON の書き換えを監視し、書き換えられたらワーカースレッドで読み直す
+	struct CatalogWatcher
+	{
+		explicit CatalogWatcher(FilePathView jsonPath);
+
+		CatalogWatcher(const CatalogWatcher&)            = delete;
+		CatalogWatcher& operator=(const CatalogWatcher&) = delete;
+
+		/// @brief JSON が書き換えられていて、読み直しを始められるなら true を返す。
+		bool isChanged();
+
+		/// @brief ワーカースレッドで JSON を読み直す。
+		/// @param loadedIcons 登録済みのアイコン。パスも更新日時も変わっていないアイコンはデコードし直さない
+		void reload(IconSnapshot loadedIcons);
+
+		/// @brief 読み直しが終わっていれば、読み直したゲームを返す。デコードし直したアイコンは登録済み。メインスレッドから毎フレーム呼ぶこと。
+		/// @return 読み直し中か、読み直しに失敗した場合は none
+		[[nodiscard]] Optional<Array<Game>> poll();
+
+	private:
+		FilePath                         m_jsonPath;
+		DirectoryWatcher                 m_watcher;
+		bool                             m_isDirty = false;
+		LoadProgress                     m_progress;
+		AsyncTask<Optional<Array<Game>>> m_task;
+	};
+} // namespace tomolatoon
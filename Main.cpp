@@ -11,6 +11,13 @@
 #include "GraphemeView.hpp"
 #include "DataTypes.hpp"
 #include "Load.hpp"
+#include "Background.hpp"
+#include "TextLayout.hpp"
+#include "Marquee.hpp"
+#include "Damage.hpp"
+#include "FramePacer.hpp"
+#include "Layout.hpp"
+#include "Card.hpp"
 
 #define DEBUGDRAW draw(Arg::top = HSV{0, 0.5, 0.5}, Arg::bottom = HSV{120, 0.5, 0.5})
 
@@ -22,7 +29,17 @@ namespace tomolatoon
 	using namespace tomolatoon::Operators; \
 	using tomolatoon::Iframe, tomolatoon::ScopedIframe2D
 
-	using App = SceneManager<String, Array<Game>>;
+	// シーン間で共有するデータ
+	struct LauncherData
+	{
+		// 読み込み済みのゲーム。List::Id の id と添字が一致する
+		Array<Game> games;
+
+		// 読み込み中のゲームの受け取り口。全て受け取ったら破棄する
+		std::shared_ptr<CatalogStream> stream;
+	};
+
+	using App = SceneManager<String, LauncherData>;
 
 	struct Button
 	{
@@ -122,169 +139,297 @@ namespace tomolatoon
 		Main(const InitData& init)
 			: IScene{init}
 		{
-			USINGS;
+			buildLayout();
 
-			for (auto&& e : getData().map([&](const Game& e) {
-					 return [&](double per, double stopTime) {
-						 //Print << U"{}, {}"_fmt(per, stopTime);
+			for (size_t i = 0; i < getData().games.size(); ++i)
+			{
+				m_context.append(addCard(i));
+			}
+		}
 
-						 auto if_1 = Iframe::Rect();
-						 auto if_2 = Iframe::RectAtScene();
+		~Main()
+		{
+			// 部分的な描き直しとフレームレートの切り替えがどれだけ効いていたかをログに残す
+			Logger << U"DamageTracker full: {}, partial: {}, idle: {}"_fmt(m_damage.stat().full, m_damage.stat().partial, m_damage.stat().idle);
+			Logger << U"FramePacer full: {:.1f}s, marquee: {:.1f}s, idle: {:.1f}s"_fmt(m_pacer.stat().fullSec, m_pacer.stat().marqueeSec, m_pacer.stat().idleSec);
+		}
 
-						 // Background
-						 //Iframe::Rect().draw(e.background);
-						 Iframe::Rect().draw(ColorF{backgroundCardR, backgroundCardG, backgroundCardB, backgroundCardAlpha});
+		/// @brief 画面の各部分の矩形を m_layout に登録する。ウィンドウの大きさが変わった時だけ計算し直される
+		void buildLayout()
+		{
+			USINGS;
 
-						 // Icon
-						 e.icon().resized(Iframe::Height() * 0.8).drawAt(10_vw, Iframe::Center().y);
+			auto& nodes = m_layoutNodes;
 
-						 //
-						 //RectF{19_vw, 70_vh, 79.5_vw, 100_vh}.draw(Palette::Lightgrey);
+			nodes.list        = m_layout.add(LayoutTree::Root, [] { return RectF{15_sw, 0, 44_sw, 100_sh}; });
+			nodes.listIgnored = m_layout.add(nodes.list, [] { return RectF{0, 90_vh, 100_vw, 100_vh}; });
+			nodes.icon        = m_layout.add(LayoutTree::Root, [] { return RectF{62_sw, 15.5_sh, 31.5_sw, 31.5_sw}; });
+			nodes.separator   = m_layout.add(LayoutTree::Root, [] { return RectF{0, 50_sh, 100_sw, 0}; });
+			nodes.footer      = m_layout.add(LayoutTree::Root, [] { return RectF{15_sw, 90_sh, 85_sw, 10_sh}; });
 
-						 {
-							 ScopedIframe2D iframe{
-								 RectF{19_vw, 7.5_vh, 79.5_vw, 65_vh}
-									 .draw(Palette::Gray)
-									 .stretched(-1_vw, 0)
-									 .asRect()
-                             };
+			nodes.description           = m_layout.add(LayoutTree::Root, [this] { return RectF{vw(descriptionX), vh(descriptionY), vw(descriptionWidth), vh(descriptionHeight)}.asRect(); });
+			nodes.descriptionBackground = m_layout.add(LayoutTree::Root, [this] { return RectF{vw(descriptionX), vh(descriptionY), vw(descriptionWidth), vh(descriptionHeight)}.asRect().stretched(vw(1.0), 0); });
 
-							 drawSingleline(e.title, per == 1.0 && stopTime > 0.5, vh(titleHeight), 1.5_vw, vh(titleY), -0.5);
-							 drawSingleline(e.author, per == 1.0 && stopTime > 0.5, vh(authorHeight), 2.0_vw, vh(authorY), -0.5);
-						 }
+			nodes.play = m_layout.add(LayoutTree::Root, [this] { return RectF{sw(playX), sh(playY), sw(playW), sh(playH)}; });
 
-						 //Iframe::Rect().DEBUGDRAW;
-					 };
-				 }))
-			{
-				const auto id = m_context.dic.add(std::move(e));
-				m_context.ary.push_back(id);
-			}
+			m_layout.update();
 		}
 
-		/// @brief x軸にどの程度移動した所が文字列の先頭位置かを返す。
-		/// なお、x軸は左上を0として、右方向へ軸を張り、右端まで来たら改行して lineHeight 下がったところに継続し、右下の方でこれ以上行を取れない所まで継続する。
-		/// @param time スクロール開始時刻からの経過時間[s]
-		/// @param additionalHiddenTime 更に隠し続ける時間[s]
-		/// @param scrollVel スクロール速度[px/s]
-		/// @param textWidth テキストを1行に描画した時の全長[px]
-		/// @param regionWidth 表示領域の幅[px]
-		/// @param lines 何行で描画するか
-		double calDiff(const double time, const double additionalHiddenTime, const double scrollVel, const double textWidth, const double regionWidth, const size_t lines) const noexcept
+		/// @brief getData().games[index] のゲームのカードの描画クラスを登録する。List への追加は呼び出し側で行う。
+		/// List::Id の id と games の添字を揃えるため、index は m_context.dic.nextIndex() であること
+		List::Id addCard(size_t index)
 		{
-			const double loopTime    = (textWidth + regionWidth * lines) / scrollVel + additionalHiddenTime;
-			const double virtualDiff = Fmod(time, loopTime) * scrollVel;
-			return -virtualDiff < -textWidth ? -virtualDiff + additionalHiddenTime * scrollVel + textWidth + regionWidth * lines : -virtualDiff;
+			// games は読み込みが進むと伸びて再確保されるので、参照ではなく添字で持つ
+			const auto id = m_context.dic.add([this, index](double per, double stopTime) {
+				m_card.draw(getData().games[index], cardStyle(), per, stopTime);
+			});
+
+			return id;
 		}
 
-		void drawSingleline(const String& string, const bool enableScrooll, const double fontSize, const double x, const double y, const double stopTimeDiff = 0.0)
+		/// @brief 読み直したゲームを、exe をキーにして今のゲームと突き合わせ、追加・削除・更新のあったものだけを反映する。
+		/// 同じ exe のゲームが複数ある時は、並んでいる順に1つずつ対応させる。中央のカードはなるべく変わらないようにする。
+		void applyReload(Array<Game> reloaded)
 		{
-			if (enableScrooll)
-			{
-				const DrawableText text   = FontAsset(U"Black")(string);
-				const RectF        region = text.region(fontSize, x, y);
+			auto& games = getData().games;
 
-				const double xDiff = region.w > Iframe::Width() ? calDiff(m_context.stoppingTime() + stopTimeDiff, additionalHiddenTime, scrollVelocity, region.w, Iframe::Width(), 1) : 0;
-				text.draw(fontSize, x + xDiff, y);
-			}
-			else
+			// exe -> その exe のカード。並んでいる順に back から取り出せるよう、逆順に積む
+			HashTable<URL, Array<List::Id>> current;
+
+			for (auto&& id : m_context.ary | std::views::reverse)
 			{
-				FontAsset(U"Black")(string).draw(fontSize, x, y);
+				current[games[id.id].exe].push_back(id);
 			}
-		}
-
-		/// @brief スクロールもする複数行に渡る文字列表示を行います。ScopedIframe を使って描画領域を制限のこと。
-		void drawMultiline(const String& string, const size_t lines, const bool enableScrooll, const double fontSize, const Vec2 firstPos, const double stopTimeDiff = 0.0) const
-		{
-			// x軸は左上を0として、右方向へ軸を張り、右端まで来たら改行して lineHeight 下がったところに継続し、右下の方でこれ以上行を取れない所まで継続する。
 
-			const double width            = Iframe::Width();
-			const RectF  singleLineRegion = FontAsset(U"Medium")(string).region(fontSize);
-			const double lineHeight       = singleLineRegion.h;
-			const double stringAllWidth   = singleLineRegion.w;
-			const double widthCapacity    = width * lines;
+			Array<List::Id> newAry;
+			newAry.reserve(reloaded.size());
 
-			const auto xMappingToVec2 = [&](const double x) {
-				if (x < width)
+			for (auto&& game : reloaded)
+			{
+				if (auto it = current.find(game.exe); it != current.end())
 				{
-					return firstPos.movedBy(x, 0);
+					// 更新
+					const List::Id id  = it->second.back();
+					Game&          old = games[id.id];
+
+					if (game.iconPath == old.iconPath && game.iconWriteTime == old.iconWriteTime)
+					{
+						// アイコンは変わっていないので、登録済みのものをそのまま使う
+						game.id = old.id;
+					}
+					else
+					{
+						// アセット名は読み込み毎に一意なので、使わなくなったものは登録ごと消す
+						TextureAsset::Unregister(old.iconAssetName());
+					}
+
+					old = std::move(game);
+					m_draw.invalidate(id);
+					m_gridDraw.invalidate(id);
+					newAry.push_back(id);
+
+					if (it->second.pop_back(); it->second.isEmpty())
+					{
+						current.erase(it);
+					}
 				}
 				else
 				{
-					const size_t newlines = x / width;
-					return firstPos.movedBy(x - width * newlines, lineHeight * newlines);
+					// 追加
+					// 削除されたカードのスロットが使い回される時は、games のその位置も使い回す
+					if (const size_t index = m_context.dic.nextIndex(); index < games.size())
+					{
+						games[index] = std::move(game);
+					}
+					else
+					{
+						games.push_back(std::move(game));
+					}
+
+					newAry.push_back(addCard(m_context.dic.nextIndex()));
 				}
-			};
+			}
 
-			const auto xToDrawPos = [&](const double x, const double w) -> std::tuple<Optional<Vec2>, Optional<Vec2>> {
-				if (x + w < 0 || widthCapacity < x)
+			// 他のゲームと同じアイコンだったためにデコードされなかったものは、パスからの読み込みに任せる
+			for (auto&& id : newAry)
+			{
+				if (const Game& game = games[id.id]; not TextureAsset::IsRegistered(game.iconAssetName()))
 				{
-					return {none, none};
+					TextureAsset::Register(game.iconAssetName(), game.iconPath);
 				}
-				// 端っこに来てなければ width で mod を取っても大小は変わらない
-				else if (Fmod(x, width) <= Fmod(x + w, width) || widthCapacity < x + w)
+			}
+
+			// 削除
+			// games は List::Id の id と添字を揃えておくため、詰めずに残しておき、次に追加されるゲームが使い回す
+			for (auto&& [exe, ids] : current)
+			{
+				for (auto&& id : ids)
+				{
+					TextureAsset::Unregister(games[id.id].iconAssetName());
+					m_context.dic.erase(id);
+					m_draw.invalidate(id);
+					m_gridDraw.invalidate(id);
+				}
+			}
+
+			// 説明文が変わっているかもしれない
+			m_textLayoutCache.clear();
+
+			m_context.rearrange(std::move(newAry));
+			m_damage.invalidateAll();
+		}
+
+		IconSnapshot loadedIcons() const
+		{
+			IconSnapshot snapshot;
+
+			for (auto&& id : m_context.ary)
+			{
+				const Game& game = getData().games[id.id];
+				snapshot.emplace(game.iconPath, game.iconWriteTime);
+			}
+
+			return snapshot;
+		}
+
+		/// @brief カードの見た目。デバッグ用のスライダーで変わるので、描画する度に作る
+		CardDrawer::Style cardStyle() const
+		{
+			return {
+				.background           = ColorF{backgroundCardR, backgroundCardG, backgroundCardB, backgroundCardAlpha},
+				.titleHeight          = titleHeight,
+				.authorHeight         = authorHeight,
+				.titleY               = titleY,
+				.authorY              = authorY,
+				.scrollVelocity       = scrollVelocity,
+				.additionalHiddenTime = additionalHiddenTime,
+			};
+		}
+
+		/// @brief スクロールもする複数行に渡る文字列表示を行います。ScopedIframe を使って描画領域を制限のこと。
+		void drawMultiline(const uint32 id, const String& string, const size_t lines, const bool enableScrooll, const double fontSize, const Vec2 firstPos, const double stopTimeDiff = 0.0) const
+		{
+			const double      width  = Iframe::Width();
+			const TextLayout& layout = m_textLayoutCache.get({id, U"Medium", fontSize, width, lines}, string);
+
+			if (enableScrooll && layout.textWidth() > layout.widthCapacity())
+			{
+				const double startX = MarqueeDiff(m_context.stoppingTime() + stopTimeDiff, additionalHiddenTime, scrollVelocity, layout.textWidth(), width, lines);
+
+				// 流れている間は毎フレーム変わる
+				m_damage.animated(Iframe::RectAtScene());
+
+				// 流れている間は帯にしたものを描画する
+				if (const Texture* strip = m_marqueeCache.get(U"Medium", fontSize, string))
 				{
-					return {xMappingToVec2(x), none};
+					DrawMarquee(*strip, firstPos, startX, width, lines, layout.lineHeight());
 				}
 				else
 				{
-					return {xMappingToVec2(x), xMappingToVec2(x + w).movedBy(-w, 0)};
+					layout.drawScrolled(firstPos, startX);
 				}
-			};
-
-			const double startX    = enableScrooll && stringAllWidth > widthCapacity ? calDiff(m_context.stoppingTime() + stopTimeDiff, additionalHiddenTime, scrollVelocity, stringAllWidth, width, lines) : 0;
-			const auto   graphemes = string | tomolatoon::views::graphme;
-			auto         it        = std::ranges::begin(graphemes);
-			auto         end       = std::ranges::end(graphemes);
-			for (double x = startX; it != end; ++it)
+			}
+			else if (enableScrooll)
 			{
-				const String& grapheme = *it;
+				layout.drawScrolled(firstPos, 0);
+			}
+			else
+			{
+				layout.drawWrapped(firstPos);
+			}
+		}
 
-				DrawableText text   = FontAsset(U"Medium")(grapheme);
-				RectF        region = text.region(fontSize);
+		void update() override
+		{
+			ClearPrint();
 
-				auto [f, s] = xToDrawPos(x, region.w);
+			USINGS;
 
-				const auto draw = [&](const Optional<Vec2>& p) {
-					if (p) text.draw(fontSize, p.value());
-				};
+			// 読み込みが終わっていなければ、読み込めた分を末尾に追加していく
+			if (auto& stream = getData().stream)
+			{
+				for (auto&& game : stream->poll())
+				{
+					getData().games.push_back(std::move(game));
+					m_context.append(addCard(getData().games.size() - 1));
+					m_damage.invalidateAll();
+				}
 
-				if (not enableScrooll)
+				if (stream->isFinished())
 				{
-					const auto is = [&](Array<StringView> svs) {
-						return svs.any([&](auto e) { return e == grapheme; });
-					};
-					if (is({U"、", U"。"}) && f && s)
+					if (not stream->jsonPath().isEmpty())
 					{
-						draw(f);
-						x = width;
-						continue;
+						m_watcher = std::make_unique<CatalogWatcher>(stream->jsonPath());
 					}
+
+					stream.reset();
+				}
+			}
+			// 読み込みが終わってからは JSON の書き換えを監視する
+			else if (m_watcher)
+			{
+				if (m_watcher->isChanged())
+				{
+					m_watcher->reload(loadedIcons());
 				}
 
-				draw(f), draw(s);
+				if (auto reloaded = m_watcher->poll(); reloaded && *reloaded)
+				{
+					applyReload(std::move(*reloaded));
+				}
+			}
 
-				x += region.w;
+			// ウィンドウサイズが変わったら、古いサイズ用に作ったものは使われなくなるので解放する
+			if (const Size sceneSize = Scene::Size(); sceneSize != m_sceneSize)
+			{
+				m_sceneSize = sceneSize;
+				m_layout.update();
+				m_backgroundCache.clear();
+				m_textLayoutCache.clear();
+				m_textMeasureCache.clear();
+				m_marqueeCache.clear();
+				m_draw.clear();
+				m_gridDraw.clear();
+				m_frame = m_renderTexturePool.acquire(sceneSize);
+				m_renderTexturePool.releaseUnused();
 			}
-		}
 
-		void update() override
-		{
-			ClearPrint();
+			// 読み込みに失敗したか JSON にゲームが無いと、選ばれているカードが無い。読み直しで増えるまでは何もしない
+			if (not m_context.ary)
+			{
+				return;
+			}
 
-			USINGS;
+			// G でリストとグリッドを切り替える
+			if (KeyG.down())
+			{
+				m_isGrid = not m_isGrid;
+				m_context.setColumns(m_isGrid ? GridColumns : 1);
+			}
+			// グリッドでは左右で列を選ぶ
+			if (m_isGrid && m_context.state == List::Context::State::Stopping)
+			{
+				if (KeyLeft.down() && m_context.selectedColumn > 0)
+				{
+					--m_context.selectedColumn;
+				}
+				if (KeyRight.down() && m_context.selectedColumn + 1 < m_context.columns)
+				{
+					++m_context.selectedColumn;
+				}
+			}
 
 			// List
 			{
-				ScopedIframe2D iframe(RectF(sliderStart, 0, 44_sw, 100_sh).asRect());
-				m_context.isMouseIgnore = RectF{0, 90_vh, 100_vw, 100_vh}.mouseOver();
+				ScopedIframe2D iframe(m_layout[m_layoutNodes.list].asRect());
+				m_context.isMouseIgnore = m_layout[m_layoutNodes.listIgnored].mouseOver();
 				m_update.update(m_context);
 			}
 			// ボタンの類
 			{
-				if (m_play.update(RectF{sw(playX), sh(playY), sw(playW), sh(playH)}.asRect()).is_clicked())
+				if (m_play.update(m_layout[m_layoutNodes.play].asRect()).is_clicked())
 				{
-					if (auto&& target = getData()[m_context.cur().id().id].exe; isURL(target))
+					if (auto&& target = getData().games[m_context.cur().id().id].exe; isURL(target))
 					{
 						System::LaunchBrowser(target);
 					}
@@ -294,73 +439,140 @@ namespace tomolatoon
 					}
 				}
 			}
+
+			// 見た目を決める状態が前のフレームと同じなら、流れている文字の所だけを描き直す
+			const VisualState visualState = {
+				.sceneSize      = Scene::Size(),
+				.selected       = m_context.cur().id().id,
+				.prevStopped    = m_context.prev().id().id,
+				.state          = m_context.state,
+				.diff           = m_context.rendered().diff(),
+				.cardHeight     = m_context.animations.value(m_context.toStoppingHeight),
+				.isGrid         = m_isGrid,
+				.selectedColumn = m_context.selectedColumn,
+				.scrolling      = m_context.stoppingTime() > 0.5,
+				.playHovered    = m_play.region().mouseOver(),
+			};
+
+			m_damage.beginFrame(visualState != m_visualState);
+			m_visualState = visualState;
+
+			// 誰も触っておらず、流れている文字しか動いていなければフレームレートを落とす
+			m_pacer.update({
+				.input     = not Cursor::Velocity().isZero() || MouseL.pressed() || Mouse::Wheel() != 0 || not Keyboard::GetAllInputs().isEmpty() || m_context.holdingState.isPressed(),
+				.animating = m_context.state != List::Context::State::Stopping || m_damage.isFull(),
+				.marquee   = not m_damage.isIdle(),
+			});
 		}
 
-		void draw() const override
+		/// @brief 画面を描画する。region と重ならない部分は省く
+		void drawScene(const Rect& region) const
 		{
-			//Print << Profiler::GetStat().drawCalls;
-
 			USINGS;
 
 			auto&& prevStoppedSelected = m_context.prev().id().id;
-			auto&& prevStoppedIcon     = getData()[prevStoppedSelected].icon();
-			auto&& selectedIcon        = getData()[m_context.cur().id().id].icon();
+			auto&& prevStoppedIcon     = getData().games[prevStoppedSelected].icon();
+			auto&& selected            = getData().games[m_context.cur().id().id];
+			auto&& selectedIcon        = selected.icon();
 
 			// 背景
 			{
 				//iconResized.draw(ColorF{backgroundR, backgroundG, backgroundB, backgroundAlpha});
 
-				int32  max         = Max(Scene::Width(), Scene::Height());
-				auto&& iconResized = selectedIcon.resized(max);
-
-				// 明らかに効率的ではないが無視（プロファイラーの警告は無効化）
-				// 強力なぼかし
-				const RenderTexture buffer1{iconResized.size.asPoint()};
-				const RenderTexture to1{iconResized.size.asPoint()};
-
-				const RenderTexture buffer4{iconResized.size.asPoint() / 4};
-				const RenderTexture to4{iconResized.size.asPoint() / 4};
+				int32 max = Max(Scene::Width(), Scene::Height());
 
-				const RenderTexture buffer8{iconResized.size.asPoint() / 8};
-				const RenderTexture to8{iconResized.size.asPoint() / 8};
+				// ぼかしは重いので、ゲームとウィンドウサイズが変わらない限り作り直さない
+				const Texture& blurred = m_backgroundCache.get(selected.id.value, selectedIcon, Scene::Size());
 
-				Shader::GaussianBlur(iconResized, buffer1, to1);
-				Shader::Downsample(to1, to4);
-				Shader::GaussianBlur(to4, buffer4, to4);
-				Shader::Downsample(to4, to8);
-				Shader::GaussianBlur(to8, buffer8, to8);
-
-				to8.resized(max).draw(ColorF{backgroundR, backgroundG, backgroundB, backgroundAlpha});
+				blurred.resized(max).draw(ColorF{backgroundR, backgroundG, backgroundB, backgroundAlpha});
 
 				// 上からピンクを描画
 				Iframe::Rect().draw(ColorF{backgroundAddR, backgroundAddG, backgroundAddB, backgroundAddAlpha});
 			}
 			// List
+			if (const Rect listRect = m_layout[m_layoutNodes.list].asRect(); region.intersects(listRect))
 			{
-				ScopedIframe2D iframe(RectF(sliderStart, 0, 44_sw, 100_sh).asRect());
-				m_draw.draw(m_context);
+				ScopedIframe2D iframe(listRect);
+
+				if (m_isGrid)
+				{
+					m_gridDraw.draw(m_context);
+				}
+				else
+				{
+					m_draw.draw(m_context);
+				}
 			}
 			// icon
+			if (const RectF& iconRect = m_layout[m_layoutNodes.icon]; region.intersects(iconRect.asRect()))
 			{
-				prevStoppedIcon.resized(31.5_sw).draw(62_sw, 15.5_sh);
+				prevStoppedIcon.resized(iconRect.w).draw(iconRect.pos);
 			}
 			// その他
 			{
-				Line{0, 50_sh, Scene::Width(), 50_sh}.draw(LineStyle::Default, 1, ColorF{Palette::White, 1});
-				RectF{sliderStart, 90_sh, 85_sw, 10_sh}.asRect().draw(Palette::White);
+				Line{m_layout[m_layoutNodes.separator].tl(), m_layout[m_layoutNodes.separator].tr()}.draw(LineStyle::Default, 1, ColorF{Palette::White, 1});
+				m_layout[m_layoutNodes.footer].asRect().draw(Palette::White);
 			}
 			// Description
+			if (const Rect background = m_layout[m_layoutNodes.descriptionBackground].asRect(); region.intersects(background))
 			{
-				Rect rect = RectF{vw(descriptionX), vh(descriptionY), vw(descriptionWidth), vh(descriptionHeight)}.asRect();
-				rect.stretched(vw(1.0), 0).draw(Palette::Lightskyblue);
+				background.draw(Palette::Lightskyblue);
 
-				ScopedIframe2D iframe(rect);
-				drawMultiline(getData()[prevStoppedSelected].description, (size_t)descriptionLines, m_context.state == List::Context::State::Stopping && m_context.stoppingTime() > 0.5, vh(descriptionFontSize), {0, vh(descriptionDiff)}, -0.5);
+				ScopedIframe2D iframe(m_layout[m_layoutNodes.description].asRect());
+				drawMultiline(getData().games[prevStoppedSelected].id.value, getData().games[prevStoppedSelected].description, (size_t)descriptionLines, m_context.state == List::Context::State::Stopping && m_context.stoppingTime() > 0.5, vh(descriptionFontSize), {0, vh(descriptionDiff)}, -0.5);
 			}
 			// ボタンの類
+			if (region.intersects(m_play.region().asRect()))
 			{
 				m_play.draw();
 			}
+		}
+
+		void draw() const override
+		{
+			//Print << Profiler::GetStat().drawCalls;
+			//Print << U"RenderTexturePool hits: {}, misses: {}, resident: {} bytes"_fmt(m_renderTexturePool.stat().hits, m_renderTexturePool.stat().misses, m_renderTexturePool.stat().residentBytes);
+
+			if (not m_context.ary)
+			{
+				USINGS;
+
+				FontAsset(U"Medium")(U"表示できるゲームがありません").drawAt(5_vh, Scene::Center());
+				return;
+			}
+
+			// 前のフレームの描画結果を m_frame に残しておき、変わった所だけを描き直す
+			if (not m_damage.isIdle())
+			{
+				const ScopedRenderTarget2D target{*m_frame};
+
+				if (m_damage.isFull())
+				{
+					m_frame->clear(Scene::GetBackground());
+					drawScene(Scene::Rect());
+				}
+				else
+				{
+					for (const Rect& region : m_damage.regions())
+					{
+						const auto scissor = CreateScissorRect(region);
+
+						{
+							const ScopedRenderStates2D opaque{BlendState::Opaque};
+							region.draw(Scene::GetBackground());
+						}
+
+						drawScene(region);
+					}
+				}
+
+				m_damage.drawn();
+			}
+
+			{
+				const ScopedRenderStates2D opaque{BlendState::Opaque};
+				m_frame->draw();
+			}
 
 //#define LISTDRAWER_DEBUG
 #ifdef LISTDRAWER_DEBUG
@@ -370,6 +582,11 @@ namespace tomolatoon
 # define SLIDER(name, min, max, ybeg) SimpleGUI::Slider(U"{}: {:.2f})"_fmt(CAT(U, #name), name), name, min, max, Vec2{0, ybeg * 50}, 300, 400);
 # define LISTDRAWER_VAR_DEFINE        double mutable
 
+			// スライダーで変えた値は DamageTracker と LayoutTree には分からないので、毎フレーム全体を計算し直す
+			m_damage.invalidateAll();
+			m_layout.invalidate();
+			m_layout.update();
+
 			int32 i = 2;
 			/*SLIDER(titleHeight, 0, 100, i++);
 			SLIDER(authorHeight, 0, 100, i++);
@@ -413,16 +630,75 @@ namespace tomolatoon
 		}
 
 	private:
-		tomolatoon::List::Context m_context;
-		tomolatoon::List::Update  m_update;
-		tomolatoon::List::Draw    m_draw;
+		// 描画中に使うオフスクリーンの RenderTexture は全てここから借りる
+		// 借りているものより先に破棄されないように、最初に置く
+		mutable RenderTexturePool m_renderTexturePool;
+
+		tomolatoon::List::Context  m_context{static_cast<double>(Scene::Height())};
+		tomolatoon::List::Update   m_update;
+		tomolatoon::List::Draw     m_draw{m_renderTexturePool};
+		tomolatoon::List::GridDraw m_gridDraw{m_renderTexturePool};
+
+		// 見た目を決める状態。前のフレームと違えば全体を描き直す
+		struct VisualState
+		{
+			bool operator==(const VisualState&) const = default;
+
+			Size                 sceneSize      = {};
+			size_t               selected       = 0;
+			size_t               prevStopped    = 0;
+			List::Context::State state          = {};
+			double               diff           = 0.0;
+			double               cardHeight     = 0.0;
+			bool                 isGrid         = false;
+			size_t               selectedColumn = 0;
+			bool                 scrolling      = false;
+			bool                 playHovered    = false;
+		};
 
-		Button m_play = {
-			RectF{Units::sw(playX), Units::sh(playY), Units::sw(playW), Units::sh(playH)},
-			U"Play"
-        };
+		// グリッド表示の時の1行の枚数
+		static constexpr size_t GridColumns = 3;
 
-		const double sliderStart = Units::sw(15);
+		bool m_isGrid = false;
+
+		Size m_sceneSize = Scene::Size();
+
+		std::unique_ptr<CatalogWatcher> m_watcher;
+
+		mutable BlurredBackgroundCache m_backgroundCache{m_renderTexturePool};
+		mutable TextLayoutCache        m_textLayoutCache;
+		TextMeasureCache               m_textMeasureCache;
+		mutable MarqueeCache           m_marqueeCache{m_renderTexturePool};
+
+		// 前のフレームの描画結果。変わった所だけを描き直して、毎フレーム画面に写す
+		RenderTexturePool::Lease m_frame = m_renderTexturePool.acquire(Scene::Size());
+		mutable DamageTracker    m_damage;
+		VisualState              m_visualState;
+
+		FramePacer m_pacer;
+
+		// 矩形は update で m_layout から与える
+		Button m_play = {RectF{}, U"Play"};
+
+		// 画面の各部分の矩形。buildLayout で登録する
+		struct LayoutNodes
+		{
+			LayoutTree::Node list                  = 0;
+			LayoutTree::Node listIgnored           = 0; // ドラッグを始められない所
+			LayoutTree::Node icon                  = 0;
+			LayoutTree::Node separator             = 0;
+			LayoutTree::Node footer                = 0;
+			LayoutTree::Node description           = 0;
+			LayoutTree::Node descriptionBackground = 0;
+			LayoutTree::Node play                  = 0;
+		};
+
+		// カードの中は描画中に計算し直すので mutable
+		mutable LayoutTree m_layout;
+		LayoutNodes        m_layoutNodes;
+
+		// カードの中の矩形は m_layout に登録する
+		CardDrawer m_card{m_layout, m_textMeasureCache, m_marqueeCache, m_damage};
 
 		LISTDRAWER_VAR_DEFINE titleHeight         = 40;
 		LISTDRAWER_VAR_DEFINE authorHeight        = 35;
@@ -462,17 +738,26 @@ namespace tomolatoon
 
 	struct Load : App::Scene
 	{
+		// 最初の1画面分のカードが揃ったら Main に移る
+		inline static constexpr size_t FirstScreenful = 9;
+
 		Load(const InitData& init)
 			: IScene{init}
-			, gamesLoad{[]() { return InitialLoad(); }}
-		{}
+		{
+			getData().stream = std::make_shared<CatalogStream>();
+		}
 
 		void update() override
 		{
-			if (gamesLoad.isReady())
+			auto& stream = *getData().stream;
+
+			for (auto&& game : stream.poll())
 			{
-				getData() = gamesLoad.get();
+				getData().games.push_back(std::move(game));
+			}
 
+			if (getData().games.size() >= FirstScreenful || stream.isFinished())
+			{
 				changeScene(U"Main");
 			}
 		}
@@ -481,11 +766,19 @@ namespace tomolatoon
 		{
 			USINGS;
 
+			const LoadProgress& progress = getData().stream->progress();
+			const size_t        total    = progress.iconsTotal;
+			const size_t        decoded  = progress.iconsDecoded;
+			const size_t        uploaded = progress.iconsUploaded;
+
 			Circle{Scene::Center(), 40_vh}.drawArc(Scene::Time() * 120_deg, 300_deg, 4, 4);
-		}
 
-	private:
-		AsyncTask<Array<Game>> gamesLoad;
+			if (total)
+			{
+				Circle{Scene::Center(), 38_vh}.drawArc(0_deg, 360_deg * uploaded / total, 2, 2);
+				FontAsset(U"Medium")(U"{} / {}"_fmt(decoded, total)).drawAt(5_vh, Scene::Center());
+			}
+		}
 	};
 
 #undef USINGS
@@ -499,10 +792,6 @@ decltype(auto) as_clref(auto&& t)
 
 void Main()
 {
-	// 毎フレーム作ってると怒られるやつを無効化するやつ
-	// あんまり良くないけどしらん
-	Profiler::EnableAssetCreationWarning(false);
-
 	const int32 baseFontSize = System::EnumerateMonitors()[System::GetCurrentMonitorIndex()].fullscreenResolution.y / 15;
 
 	FontAsset::Register(U"Thin", baseFontSize, Typeface::Mplus_Thin);
@@ -0,0 +1,82 @@
+﻿#include "Marquee.hpp"
+#include "Viewport.hpp"
+
+namespace tomolatoon
+{
+	const Texture* MarqueeCache::get(const AssetName& font, double fontSize, const String& text)
+	{
+		const auto matches = [&](const Entry& e) {
+			return e.key.fontSize == fontSize && e.key.font == font && e.key.text == text;
+		};
+
+		if (auto it = std::ranges::find_if(m_entries, matches); it != m_entries.end())
+		{
+			// 先頭に持ってくる
+			std::rotate(m_entries.begin(), it, std::next(it));
+		}
+		else
+		{
+			Key key{font, fontSize, text};
+
+			// 作れなかった時も空の帯として覚えておき、次からは測り直さずに nullptr を返す
+			auto strip = build(key);
+
+			if (m_entries.size() >= m_capacity)
+			{
+				m_entries.pop_back();
+			}
+
+			m_entries.push_front(Entry{std::move(key), std::move(strip)});
+		}
+
+		const Entry& entry = m_entries.front();
+
+		return entry.strip ? &entry.strip.get() : nullptr;
+	}
+
+	RenderTexturePool::Lease MarqueeCache::build(const Key& key)
+	{
+		const DrawableText text   = FontAsset(key.font)(key.text);
+		const RectF        region = text.region(key.fontSize);
+		const Size         size{static_cast<int32>(Ceil(region.w)), static_cast<int32>(Ceil(region.h))};
+
+		if (size.x <= 0 || size.y <= 0 || MaxStripWidth < size.x)
+		{
+			return {};
+		}
+
+		auto strip = m_pool.acquire(size);
+
+		{
+			const ScopedOffscreen2D offscreen{*strip};
+
+			text.draw(key.fontSize, 0, 0);
+		}
+
+		return strip;
+	}
+
+	double MarqueeDiff(double time, double additionalHiddenTime, double scrollVel, double textWidth, double regionWidth, size_t lines) noexcept
+	{
+		const double loopTime    = (textWidth + regionWidth * lines) / scrollVel + additionalHiddenTime;
+		const double virtualDiff = Fmod(time, loopTime) * scrollVel;
+		return -virtualDiff < -textWidth ? -virtualDiff + additionalHiddenTime * scrollVel + textWidth + regionWidth * lines : -virtualDiff;
+	}
+
+	void DrawMarquee(const Texture& strip, Vec2 firstPos, double startX, double width, size_t lines, double lineHeight)
+	{
+		const ScopedRenderStates2D blend{BlendState::Premultiplied};
+
+		for (size_t line = 0; line < lines; ++line)
+		{
+			// この行に見えている範囲 (帯の上での x)
+			const double begin = Max(width * line - startX, 0.0);
+			const double end   = Min(width * (line + 1) - startX, static_cast<double>(strip.width()));
+
+			if (begin < end)
+			{
+				strip(RectF{begin, 0, end - begin, strip.height()}).draw(firstPos.movedBy(begin + startX - width * line, lineHeight * line));
+			}
+		}
+	}
+} // namespace tomolatoon
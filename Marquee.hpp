@@ -0,0 +1,70 @@
+﻿#pragma once
+
+#include <Siv3D.hpp>
+
+#include "RenderTexturePool.hpp"
+
+namespace tomolatoon
+{
+	// 流れる文字列を1行に描画した帯を、(フォント, サイズ, 文字列) 毎にキャッシュする
+	// 流れている間は毎フレーム帯の見えている部分を切り出して描画するだけになり、文字を描き直さない
+	// 直近に使われたものから capacity 個までを保持し、溢れたら最も古く使われたものから捨てる
+	struct MarqueeCache
+	{
+		// これより長い文字列は帯にせず、文字毎に描画する
+		inline static constexpr int32 MaxStripWidth = 8192;
+
+		MarqueeCache(RenderTexturePool& pool, size_t capacity = 8) noexcept
+			: m_pool(pool)
+			, m_capacity(Max<size_t>(capacity, 1))
+		{}
+
+		/// @brief text を font で fontSize の大きさに1行で描画した帯を取得する。キャッシュに無ければ作成する。
+		/// @return 帯が長すぎて作れない時は nullptr
+		const Texture* get(const AssetName& font, double fontSize, const String& text);
+
+		void clear() noexcept
+		{
+			m_entries.clear();
+		}
+
+	private:
+		struct Key
+		{
+			bool operator==(const Key&) const = default;
+
+			AssetName font;
+			double    fontSize;
+			String    text;
+		};
+
+		struct Entry
+		{
+			Key                      key;
+			RenderTexturePool::Lease strip; // 長すぎて作れなかった時は空
+		};
+
+		RenderTexturePool::Lease build(const Key& key);
+
+		RenderTexturePool& m_pool;
+
+		// 先頭ほど最近使われたもの
+		Array<Entry> m_entries  = {};
+		size_t       m_capacity = 8;
+	};
+
+	/// @brief x軸にどの程度移動した所が文字列の先頭位置かを返す。
+	/// なお、x軸は左上を0として、右方向へ軸を張り、右端まで来たら改行して lineHeight 下がったところに継続し、右下の方でこれ以上行を取れない所まで継続する。
+	/// @param time スクロール開始時刻からの経過時間[s]
+	/// @param additionalHiddenTime 更に隠し続ける時間[s]
+	/// @param scrollVel スクロール速度[px/s]
+	/// @param textWidth テキストを1行に描画した時の全長[px]
+	/// @param regionWidth 表示領域の幅[px]
+	/// @param lines 何行で描画するか
+	double MarqueeDiff(double time, double additionalHiddenTime, double scrollVel, double textWidth, double regionWidth, size_t lines) noexcept;
+
+	/// @brief 帯 strip を startX だけずらして、幅 width の行に lines 行まで流し込んで描画する。行の右端からはみ出た分は次の行の左端に続ける。
+	/// @param firstPos 1行目の左上
+	/// @param lineHeight 行の高さ[px]
+	void DrawMarquee(const Texture& strip, Vec2 firstPos, double startX, double width, size_t lines, double lineHeight);
+} // namespace tomolatoon
@@ -0,0 +1,52 @@
+﻿#include "RenderTexturePool.hpp"
+
+namespace tomolatoon
+{
+	void RenderTexturePool::Lease::release()
+	{
+		if (m_pool)
+		{
+			std::exchange(m_pool, nullptr)->giveBack(m_key, std::move(m_texture));
+			m_texture = {};
+		}
+	}
+
+	RenderTexturePool::Lease RenderTexturePool::acquire(Size size, const TextureFormat& format)
+	{
+		const Key key = {size, format};
+
+		++m_stat.leased;
+
+		if (auto it = m_free.find(key); it != m_free.end() && it->second)
+		{
+			++m_stat.hits;
+
+			RenderTexture texture = std::move(it->second.back());
+			it->second.pop_back();
+
+			return Lease{this, key, std::move(texture)};
+		}
+
+		++m_stat.misses;
+		m_stat.residentBytes += BytesOf(key);
+
+		return Lease{this, key, RenderTexture{size, format}};
+	}
+
+	void RenderTexturePool::releaseUnused()
+	{
+		for (auto&& [key, textures] : m_free)
+		{
+			m_stat.residentBytes -= BytesOf(key) * textures.size();
+		}
+
+		m_free.clear();
+	}
+
+	void RenderTexturePool::giveBack(const Key& key, RenderTexture&& texture)
+	{
+		--m_stat.leased;
+
+		m_free[key].push_back(std::move(texture));
+	}
+} // namespace tomolatoon
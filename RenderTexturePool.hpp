@@ -0,0 +1,137 @@
+﻿#pragma once
+
+#include <Siv3D.hpp>
+
+namespace tomolatoon
+{
+	// 一時的なオフスクリーン描画に使う RenderTexture を、サイズとフォーマット毎に使い回すプール
+	// acquire で借りた Lease が破棄されるとプールに返却され、同じサイズ・フォーマットの次の acquire で再利用される
+	struct RenderTexturePool
+	{
+		struct Key
+		{
+			bool operator==(const Key&) const = default;
+
+			Size          size;
+			TextureFormat format;
+		};
+
+		struct KeyHash
+		{
+			size_t operator()(const Key& key) const noexcept
+			{
+				return (static_cast<size_t>(key.size.x) * 73'856'093) ^ (static_cast<size_t>(key.size.y) * 19'349'663) ^ static_cast<size_t>(FromEnum(key.format.value()));
+			}
+		};
+
+		// 借りている間だけ RenderTexture を使えるハンドル。スコープを抜けるとプールに返却される
+		struct Lease
+		{
+			Lease() = default;
+
+			Lease(const Lease&)            = delete;
+			Lease& operator=(const Lease&) = delete;
+
+			Lease(Lease&& other) noexcept
+				: m_pool(std::exchange(other.m_pool, nullptr))
+				, m_key(other.m_key)
+				, m_texture(std::move(other.m_texture))
+			{}
+
+			Lease& operator=(Lease&& other) noexcept
+			{
+				if (this != &other)
+				{
+					release();
+
+					m_pool    = std::exchange(other.m_pool, nullptr);
+					m_key     = other.m_key;
+					m_texture = std::move(other.m_texture);
+				}
+
+				return *this;
+			}
+
+			~Lease()
+			{
+				release();
+			}
+
+			const RenderTexture& get() const noexcept
+			{
+				return m_texture;
+			}
+
+			const RenderTexture& operator*() const noexcept
+			{
+				return m_texture;
+			}
+
+			const RenderTexture* operator->() const noexcept
+			{
+				return &m_texture;
+			}
+
+			explicit operator bool() const noexcept
+			{
+				return m_pool != nullptr;
+			}
+
+			// 明示的にプールへ返却する
+			void release();
+
+		private:
+			friend struct RenderTexturePool;
+
+			Lease(RenderTexturePool* pool, Key key, RenderTexture texture)
+				: m_pool(pool)
+				, m_key(key)
+				, m_texture(std::move(texture))
+			{}
+
+			RenderTexturePool* m_pool    = nullptr;
+			Key                m_key     = {};
+			RenderTexture      m_texture = {};
+		};
+
+		struct Stat
+		{
+			size_t hits          = 0; // プールにあったものを貸した回数
+			size_t misses        = 0; // 新しく作成した回数
+			size_t residentBytes = 0; // プールが作成して保持している (貸出中を含む) RenderTexture の合計バイト数
+			size_t leased        = 0; // 現在貸出中の数
+		};
+
+		RenderTexturePool() = default;
+
+		RenderTexturePool(const RenderTexturePool&)            = delete;
+		RenderTexturePool& operator=(const RenderTexturePool&) = delete;
+
+		[[nodiscard]] Lease acquire(Size size, const TextureFormat& format = TextureFormat::R8G8B8A8_Unorm);
+
+		// 貸出中でない RenderTexture を全て解放する。ウィンドウサイズが変わった時など、同じサイズが二度と要求されなさそうな時に呼ぶ
+		void releaseUnused();
+
+		const Stat& stat() const noexcept
+		{
+			return m_stat;
+		}
+
+		void resetCounters() noexcept
+		{
+			m_stat.hits   = 0;
+			m_stat.misses = 0;
+		}
+
+	private:
+		static size_t BytesOf(const Key& key) noexcept
+		{
+			return static_cast<size_t>(key.size.x) * key.size.y * key.format.pixelSize();
+		}
+
+		void giveBack(const Key& key, RenderTexture&& texture);
+
+		HashTable<Key, Array<RenderTexture>, KeyHash> m_free = {};
+		Stat                                          m_stat = {};
+	};
+} // namespace tomolatoon
@@ -0,0 +1,235 @@
+﻿#include "TextLayout.hpp"
+#include "GraphemeView.hpp"
+
+namespace tomolatoon
+{
+	TextLayout::TextLayout(const Font& font, StringView text, double fontSize, double width, size_t lines)
+		: m_fontSize(fontSize)
+		, m_width(width)
+		, m_lines(lines)
+	{
+		const RectF singleLineRegion = font(text).region(fontSize);
+
+		m_textWidth  = singleLineRegion.w;
+		m_lineHeight = singleLineRegion.h;
+
+		const auto              view = text | views::graphme;
+		const Array<StringView> graphemes(view.begin(), view.end());
+
+		m_graphemes.reserve(graphemes.size());
+		m_begins.reserve(graphemes.size());
+		m_ends.reserve(graphemes.size());
+
+		double x = 0.0;
+
+		for (auto&& grapheme : graphemes)
+		{
+			DrawableText drawable = font(grapheme);
+			const double w        = drawable.region(fontSize).w;
+
+			m_graphemes.push_back(std::move(drawable));
+			m_begins.push_back(x);
+			m_ends.push_back(x + w);
+
+			x += w;
+		}
+
+		m_breaks = LineBreakOpportunities{graphemes};
+
+		layoutWrapped();
+	}
+
+	void TextLayout::layoutWrapped()
+	{
+		// 各行の先頭の書記素の添字を求める
+		// 溢れたら、その行の中で最後の改行可能位置で改行する。無ければその書記素の前で改行する
+		Array<size_t>    heads;
+		size_t           head      = 0;
+		Optional<size_t> lastBreak = none;
+
+		if (not m_graphemes.isEmpty())
+		{
+			heads.push_back(0);
+		}
+
+		for (size_t i = 1; i < m_graphemes.size() && heads.size() <= m_lines; ++i)
+		{
+			if (m_breaks.mustBreakBefore(i))
+			{
+				heads.push_back(head = i);
+				lastBreak = none;
+				continue;
+			}
+
+			if (m_breaks.canBreakBefore(i))
+			{
+				lastBreak = i;
+			}
+
+			// 句読点と空白は行末からはみ出させる
+			if (m_ends[i] - m_begins[head] <= m_width || m_breaks.canHang(i))
+			{
+				continue;
+			}
+
+			heads.push_back(head = lastBreak.value_or(i));
+			lastBreak = none;
+		}
+
+		heads.push_back(m_graphemes.size());
+
+		for (size_t line = 0; line + 1 < heads.size() && line < m_lines; ++line)
+		{
+			for (size_t i = heads[line]; i < heads[line + 1]; ++i)
+			{
+				if (not m_breaks.isNewline(i))
+				{
+					m_wrapped.push_back({i, {m_begins[i] - m_begins[heads[line]], m_lineHeight * line}});
+				}
+			}
+		}
+	}
+
+	void TextLayout::drawWrapped(Vec2 firstPos) const
+	{
+		for (auto&& [index, offset] : m_wrapped)
+		{
+			m_graphemes[index].draw(m_fontSize, firstPos + offset);
+		}
+	}
+
+	void TextLayout::drawScrolled(Vec2 firstPos, double startX) const
+	{
+		// 見えている範囲に入る最初の書記素から、見えている範囲を出るまで
+		const auto first = std::ranges::lower_bound(m_ends, -startX);
+
+		for (size_t i = std::distance(m_ends.begin(), first); i < m_graphemes.size() && startX + m_begins[i] <= widthCapacity(); ++i)
+		{
+			auto [f, s] = xToDrawOffsets(startX + m_begins[i], m_ends[i] - m_begins[i]);
+
+			if (f) m_graphemes[i].draw(m_fontSize, firstPos + *f);
+			if (s) m_graphemes[i].draw(m_fontSize, firstPos + *s);
+		}
+	}
+
+	Vec2 TextLayout::xToOffset(double x) const noexcept
+	{
+		if (x < m_width)
+		{
+			return {x, 0.0};
+		}
+		else
+		{
+			const size_t newlines = static_cast<size_t>(x / m_width);
+			return {x - m_width * newlines, m_lineHeight * newlines};
+		}
+	}
+
+	std::pair<Optional<Vec2>, Optional<Vec2>> TextLayout::xToDrawOffsets(double x, double w) const noexcept
+	{
+		if (x + w < 0 || widthCapacity() < x)
+		{
+			return {none, none};
+		}
+		// 端っこに来てなければ width で mod を取っても大小は変わらない
+		else if (Fmod(x, m_width) <= Fmod(x + w, m_width) || widthCapacity() < x + w)
+		{
+			return {xToOffset(x), none};
+		}
+		else
+		{
+			return {xToOffset(x), xToOffset(x + w).movedBy(-w, 0)};
+		}
+	}
+
+	const TextLayout& TextLayoutCache::get(const Key& key, StringView text)
+	{
+		if (auto it = std::ranges::find(m_entries, key, &Entry::key); it != m_entries.end())
+		{
+			// 先頭に持ってくる
+			std::rotate(m_entries.begin(), it, std::next(it));
+		}
+		else
+		{
+			if (m_entries.size() >= m_capacity)
+			{
+				m_entries.pop_back();
+			}
+
+			m_entries.push_front(Entry{key, TextLayout{FontAsset(key.font), text, key.fontSize, key.width, key.lines}});
+		}
+
+		return m_entries.front().layout;
+	}
+
+	const TextMeasureCache::Measured& TextMeasureCache::get(const AssetName& font, double fontSize, const String& text)
+	{
+		Key key{font, fontSize, intern(text)};
+
+		if (auto it = m_entries.find(key); it != m_entries.end())
+		{
+			++m_stat.hits;
+			it->second.lastUsed = ++m_clock;
+			return it->second.measured;
+		}
+
+		++m_stat.misses;
+
+		if (m_entries.size() >= m_capacity)
+		{
+			// text の id は未だどのエントリーも使っていないので捨てられている。振り直す
+			evict();
+			key.textId = intern(text);
+		}
+
+		DrawableText drawable = FontAsset(font)(text);
+		const double width    = drawable.region(fontSize).w;
+
+		return m_entries.emplace(key, Entry{Measured{std::move(drawable), width}, ++m_clock}).first->second.measured;
+	}
+
+	uint32 TextMeasureCache::intern(const String& text)
+	{
+		if (auto it = m_ids.find(text); it != m_ids.end())
+		{
+			return it->second;
+		}
+
+		const uint32 id = m_nextId++;
+		m_ids.emplace(text, id);
+		return id;
+	}
+
+	void TextMeasureCache::evict()
+	{
+		Array<uint64> lastUsed(Arg::reserve = m_entries.size());
+
+		for (auto&& [key, entry] : m_entries)
+		{
+			lastUsed.push_back(entry.lastUsed);
+		}
+
+		const auto median = lastUsed.begin() + lastUsed.size() / 2;
+		std::ranges::nth_element(lastUsed, median);
+
+		const uint64 threshold = *median;
+
+		for (auto it = m_entries.begin(); it != m_entries.end();)
+		{
+			it = it->second.lastUsed <= threshold ? m_entries.erase(it) : std::next(it);
+		}
+
+		// どのエントリーからも使われなくなった文字列も捨てる
+		HashSet<uint32> live(m_entries.size());
+
+		for (auto&& [key, entry] : m_entries)
+		{
+			live.insert(key.textId);
+		}
+
+		for (auto it = m_ids.begin(); it != m_ids.end();)
+		{
+			it = live.contains(it->second) ? std::next(it) : m_ids.erase(it);
+		}
+	}
+} // namespace tomolatoon
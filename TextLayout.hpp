@@ -0,0 +1,193 @@
+﻿#pragma once
+
+#include <Siv3D.hpp>
+
+#include "LineBreak.hpp"
+
+namespace tomolatoon
+{
+	// 複数行に渡って流れる文字列のレイアウト
+	// x軸は左上を0として、右方向へ軸を張り、右端まで来たら改行して lineHeight 下がったところに継続し、右下の方でこれ以上行を取れない所まで継続する。
+	// 書記素クラスタ毎の DrawableText と送り幅、流れていない時の描画位置を作成時に求めておき、描画時は位置をずらすだけにする
+	// 流れていない時は、LineBreakOpportunities の改行可能位置で折り返す
+	struct TextLayout
+	{
+		/// @param font 描画に使うフォント
+		/// @param text 描画する文字列
+		/// @param fontSize フォントサイズ
+		/// @param width 1行の幅[px]
+		/// @param lines 何行で描画するか
+		TextLayout(const Font& font, StringView text, double fontSize, double width, size_t lines);
+
+		/// @brief 文字列を1行に描画した時の全長[px]
+		double textWidth() const noexcept
+		{
+			return m_textWidth;
+		}
+
+		double lineHeight() const noexcept
+		{
+			return m_lineHeight;
+		}
+
+		/// @brief 全ての行を合わせた幅[px]
+		double widthCapacity() const noexcept
+		{
+			return m_width * m_lines;
+		}
+
+		/// @brief 流れていない時の描画。改行可能位置で折り返し、行末の句読点は次の行に送らず行末にぶら下げる
+		void drawWrapped(Vec2 firstPos) const;
+
+		/// @brief 先頭を startX の位置にずらして描画する。
+		void drawScrolled(Vec2 firstPos, double startX) const;
+
+	private:
+		void layoutWrapped();
+
+		// x を描画位置 (firstPos からの相対位置) に変換する
+		Vec2 xToOffset(double x) const noexcept;
+
+		// x から幅 w の書記素を描画する位置。行を跨ぐ場合は2箇所になる
+		std::pair<Optional<Vec2>, Optional<Vec2>> xToDrawOffsets(double x, double w) const noexcept;
+
+		struct WrappedGlyph
+		{
+			size_t index;
+			Vec2   offset;
+		};
+
+		double m_fontSize   = 0.0;
+		double m_width      = 0.0;
+		size_t m_lines      = 0;
+		double m_textWidth  = 0.0;
+		double m_lineHeight = 0.0;
+
+		// 書記素クラスタ毎
+		Array<DrawableText> m_graphemes = {};
+		Array<double>       m_begins    = {}; // 1行に描画した時の左端
+		Array<double>       m_ends      = {}; // 1行に描画した時の右端
+
+		LineBreakOpportunities m_breaks = {};
+
+		// 流れていない時に描画するもの
+		Array<WrappedGlyph> m_wrapped = {};
+	};
+
+	// TextLayout を (ゲーム, フォント, サイズ, 幅, 行数) 毎にキャッシュする
+	// 直近に使われたものから capacity 個までを保持し、溢れたら最も古く使われたものから捨てる
+	struct TextLayoutCache
+	{
+		struct Key
+		{
+			bool operator==(const Key&) const = default;
+
+			uint32    id;
+			AssetName font;
+			double    fontSize;
+			double    width;
+			size_t    lines;
+		};
+
+		TextLayoutCache(size_t capacity = 32) noexcept
+			: m_capacity(Max<size_t>(capacity, 1))
+		{}
+
+		/// @brief key のレイアウトを取得する。キャッシュに無ければ text から作成する。
+		const TextLayout& get(const Key& key, StringView text);
+
+		void clear() noexcept
+		{
+			m_entries.clear();
+		}
+
+	private:
+		struct Entry
+		{
+			Key        key;
+			TextLayout layout;
+		};
+
+		// 先頭ほど最近使われたもの
+		Array<Entry> m_entries  = {};
+		size_t       m_capacity = 32;
+	};
+
+	// 1行の文字列の DrawableText と幅を (フォント, サイズ, 文字列) 毎にキャッシュする
+	// 文字列は intern して id で持ち、同じ文字列をサイズ毎に複製しないようにする
+	struct TextMeasureCache
+	{
+		struct Measured
+		{
+			DrawableText text;
+			double       width;
+		};
+
+		struct Stat
+		{
+			size_t hits   = 0; // キャッシュにあった回数
+			size_t misses = 0; // 新しく計測した回数
+		};
+
+		TextMeasureCache(size_t capacity = 256) noexcept
+			: m_capacity(Max<size_t>(capacity, 1))
+		{}
+
+		/// @brief font で fontSize の大きさに text を描画する時の DrawableText と幅を取得する。
+		const Measured& get(const AssetName& font, double fontSize, const String& text);
+
+		/// @brief ウィンドウサイズが変わった時など、同じサイズが二度と要求されなさそうな時に呼ぶ
+		void clear() noexcept
+		{
+			m_entries.clear();
+			m_ids.clear();
+			m_nextId = 0;
+		}
+
+		const Stat& stat() const noexcept
+		{
+			return m_stat;
+		}
+
+		void resetCounters() noexcept
+		{
+			m_stat = {};
+		}
+
+	private:
+		struct Key
+		{
+			bool operator==(const Key&) const = default;
+
+			AssetName font;
+			double    fontSize;
+			uint32    textId;
+		};
+
+		struct KeyHash
+		{
+			size_t operator()(const Key& key) const noexcept
+			{
+				return std::hash<AssetName>{}(key.font) ^ (std::hash<double>{}(key.fontSize) * 73'856'093) ^ (static_cast<size_t>(key.textId) * 19'349'663);
+			}
+		};
+
+		struct Entry
+		{
+			Measured measured;
+			uint64   lastUsed;
+		};
+
+		uint32 intern(const String& text);
+
+		// 溢れたら、古く使われた方から半分 (以上) を捨てる。使われなくなった文字列の id も一緒に捨てる
+		void evict();
+
+		HashTable<Key, Entry, KeyHash> m_entries  = {};
+		HashTable<String, uint32>      m_ids      = {}; // m_entries が使っている文字列だけを持つ
+		uint32                         m_nextId   = 0;
+		size_t                         m_capacity = 256;
+		uint64                         m_clock    = 0;
+		Stat                           m_stat     = {};
+	};
+} // namespace tomolatoon
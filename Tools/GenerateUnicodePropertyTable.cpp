@@ -0,0 +1,112 @@
+﻿// UnicodePropertyTable.cpp を生成する。Siv3D に依存しない単独のプログラム。
+// ソリューションの GenerateUnicodePropertyTable をそのまま実行すると、Tools/ から次のように動く。
+//
+//   GenerateUnicodePropertyTable.exe ..\UnicodePropertyTable.cpp
+//
+// 詰め方は UnicodeProperty.hpp の detail::PropertyTable と揃えること。
+// 生成に使った ICU と実行時の ICU がずれていないかは ListBench が確かめる。
+
+#include <unicode/uchar.h>
+#include <unicode/uversion.h>
+
+#include <cstdint>
+#include <cstdio>
+#include <map>
+#include <vector>
+
+namespace
+{
+	constexpr std::uint32_t CodePointCount = 0x110000;
+	constexpr std::uint32_t BlockBits      = 8;
+	constexpr std::uint32_t BlockSize      = 1u << BlockBits;
+	constexpr std::uint32_t GraphemeShift  = 6;
+	constexpr std::uint32_t WidthShift     = 11;
+
+	std::uint16_t Pack(UChar32 ch)
+	{
+		const auto lb  = u_getIntPropertyValue(ch, UCHAR_LINE_BREAK);
+		const auto gcb = u_getIntPropertyValue(ch, UCHAR_GRAPHEME_CLUSTER_BREAK);
+		const auto eaw = u_getIntPropertyValue(ch, UCHAR_EAST_ASIAN_WIDTH);
+
+		return static_cast<std::uint16_t>(lb | (gcb << GraphemeShift) | (eaw << WidthShift));
+	}
+
+	void WriteArray(std::FILE* out, const char* declaration, const std::vector<std::uint32_t>& values)
+	{
+		std::fprintf(out, "\t\t\t\t%s = {", declaration);
+
+		for (size_t i = 0; i < values.size(); ++i)
+		{
+			std::fprintf(out, (i % 16 == 0) ? "\n\t\t\t\t\t%u," : " %u,", values[i]);
+		}
+
+		std::fprintf(out, "\n\t\t\t\t};\n");
+	}
+} // namespace
+
+int main(int argc, char** argv)
+{
+	if (argc != 2)
+	{
+		std::fprintf(stderr, "usage: %s <output>\n", argv[0]);
+		return 1;
+	}
+
+	if (u_getIntPropertyMaxValue(UCHAR_LINE_BREAK) > 0x3F
+		|| u_getIntPropertyMaxValue(UCHAR_GRAPHEME_CLUSTER_BREAK) > 0x1F
+		|| u_getIntPropertyMaxValue(UCHAR_EAST_ASIAN_WIDTH) > 0x07)
+	{
+		std::fprintf(stderr, "property value does not fit in the packed layout\n");
+		return 1;
+	}
+
+	std::vector<std::uint32_t> stage1, stage2;
+
+	// 既に stage2 にあるブロック -> その先頭
+	std::map<std::vector<std::uint32_t>, std::uint32_t> blocks;
+	std::vector<std::uint32_t>                          block(BlockSize);
+
+	for (std::uint32_t begin = 0; begin < CodePointCount; begin += BlockSize)
+	{
+		for (std::uint32_t i = 0; i < BlockSize; ++i)
+		{
+			block[i] = Pack(static_cast<UChar32>(begin + i));
+		}
+
+		auto [it, inserted] = blocks.try_emplace(block, static_cast<std::uint32_t>(stage2.size()));
+
+		if (inserted)
+		{
+			stage2.insert(stage2.end(), block.begin(), block.end());
+		}
+
+		stage1.push_back(it->second);
+	}
+
+	if (stage2.size() > 0x10000)
+	{
+		std::fprintf(stderr, "stage2 does not fit in uint16 offsets\n");
+		return 1;
+	}
+
+	std::FILE* out = std::fopen(argv[1], "wb");
+
+	if (!out)
+	{
+		std::fprintf(stderr, "cannot open %s\n", argv[1]);
+		return 1;
+	}
+
+	std::fprintf(out, "\xEF\xBB\xBF// Tools/GenerateUnicodePropertyTable.cpp が生成したファイル。直接編集しないこと。\n");
+	std::fprintf(out, "// ICU %s / Unicode %s\n\n", U_ICU_VERSION, U_UNICODE_VERSION);
+	std::fprintf(out, "#include \"UnicodeProperty.hpp\"\n\n");
+	std::fprintf(out, "namespace tomolatoon\n{\n\tnamespace Unicode\n\t{\n\t\tnamespace Property\n\t\t{\n\t\t\tnamespace detail\n\t\t\t{\n");
+	WriteArray(out, "constinit const uint16 PropertyTable::Stage1[PropertyTable::Stage1Size]", stage1);
+	std::fprintf(out, "\n");
+	WriteArray(out, "constinit const uint16 PropertyTable::Stage2[]", stage2);
+	std::fprintf(out, "\t\t\t} // namespace detail\n\t\t} // namespace Property\n\t}     // namespace Unicode\n} // namespace tomolatoon\n");
+	std::fclose(out);
+
+	std::fprintf(stderr, "stage1: %zu, stage2: %zu\n", stage1.size(), stage2.size());
+	return 0;
+}
@@ -24,12 +24,53 @@ namespace tomolatoon
 				return static_cast<GetType>(u_getIntPropertyValue(ch, propIndex));
 			}
 
-			ULineBreak GetLineBreak(char32 ch)
+			namespace detail
 			{
-				return GetProperty<ULineBreak, UCHAR_LINE_BREAK>(ch);
+				// Line_Break, Grapheme_Cluster_Break, East_Asian_Width を1つの uint16 に詰めた二段表
+				// Stage1[ch >> BlockBits] が Stage2 の中のブロックの先頭を指し、同じ中身のブロックは共有する
+				// 中身は Tools/GenerateUnicodePropertyTable.cpp が生成する UnicodePropertyTable.cpp にあり、定数初期化される
+				// 実行時の ICU と一致するかは ListBench が確かめる
+				struct PropertyTable
+				{
+					inline static constexpr uint32 BlockBits = 8;
+					inline static constexpr uint32 BlockMask = (1u << BlockBits) - 1;
+
+					inline static constexpr uint16 LineBreakMask = 0x3F; // 6bit
+					inline static constexpr uint32 GraphemeShift = 6;
+					inline static constexpr uint16 GraphemeMask  = 0x1F; // 5bit
+					inline static constexpr uint32 WidthShift    = 11;
+					inline static constexpr uint16 WidthMask     = 0x07; // 3bit
+
+					inline static constexpr size_t Stage1Size = 0x110000 >> BlockBits;
+
+					static const uint16 Stage1[Stage1Size];
+					static const uint16 Stage2[];
+
+					static uint16 lookup(char32 ch) noexcept
+					{
+						// 範囲外は最後の (未割り当ての) 符号位置として扱う
+						ch = Min<char32>(ch, 0x10FFFF);
+						return Stage2[Stage1[ch >> BlockBits] + (ch & BlockMask)];
+					}
+				};
+			} // namespace detail
+
+			inline ULineBreak GetLineBreak(char32 ch)
+			{
+				return static_cast<ULineBreak>(detail::PropertyTable::lookup(ch) & detail::PropertyTable::LineBreakMask);
+			}
+
+			inline UGraphemeClusterBreak GetGraphemeClusterBreak(char32 ch)
+			{
+				return static_cast<UGraphemeClusterBreak>((detail::PropertyTable::lookup(ch) >> detail::PropertyTable::GraphemeShift) & detail::PropertyTable::GraphemeMask);
+			}
+
+			inline UEastAsianWidth GetEastAsianWidth(char32 ch)
+			{
+				return static_cast<UEastAsianWidth>((detail::PropertyTable::lookup(ch) >> detail::PropertyTable::WidthShift) & detail::PropertyTable::WidthMask);
 			}
 
-			String GetUnicodeName(char32 c)
+			inline String GetUnicodeName(char32 c)
 			{
 				char           buffer[100];
 				icu::ErrorCode errorCode;
@@ -0,0 +1,2934 @@
+﻿// Tools/GenerateUnicodePropertyTable.cpp が生成したファイル。直接編集しないこと。
+// ICU 72.1 / Unicode 15.0
+
+#include "UnicodeProperty.hpp"
+
+namespace tomolatoon
+{
+	namespace Unicode
+	{
+		namespace Property
+		{
+			namespace detail
+			{
+				constinit const uint16 PropertyTable::Stage1[PropertyTable::Stage1Size] = {
+					0, 256, 512, 768, 1024, 1280, 1536, 1792, 2048, 2304, 2560, 2816, 3072, 3328, 3584, 3840,
+					4096, 4352, 4608, 4864, 5120, 5376, 5632, 5888, 6144, 6400, 6656, 6912, 7168, 7424, 5376, 7680,
+					7936, 8192, 8448, 8704, 8960, 9216, 9472, 9728, 5376, 9984, 5376, 10240, 10496, 10752, 11008, 11264,
+					11520, 11776, 12032, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288,
+					12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12544, 12288, 12288,
+					12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288,
+					12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288,
+					12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288,
+					12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288,
+					12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288,
+					12800, 12288, 12288, 12288, 13056, 5376, 13312, 13568, 13824, 14080, 14336, 14592, 14848, 15104, 15360, 15616,
+					15872, 16128, 16384, 14848, 15104, 15360, 15616, 15872, 16128, 16384, 14848, 15104, 15360, 15616, 15872, 16128,
+					16384, 14848, 15104, 15360, 15616, 15872, 16128, 16384, 14848, 15104, 15360, 15616, 15872, 16128, 16384, 14848,
+					15104, 15360, 15616, 15872, 16128, 16384, 14848, 16640, 16896, 16896, 16896, 16896, 16896, 16896, 16896, 16896,
+					17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152,
+					17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 12288, 12288, 17408, 5376, 17664, 17920, 18176,
+					18432, 18688, 18944, 19200, 19456, 19712, 5376, 19968, 20224, 20480, 20736, 20992, 21248, 21504, 21760, 22016,
+					22272, 22528, 22784, 23040, 23296, 23552, 23808, 24064, 24320, 24576, 24832, 25088, 25344, 25600, 25856, 26112,
+					5376, 5376, 5376, 26368, 26624, 26880, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27392,
+					5376, 5376, 27648, 27904, 28160, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136,
+					27136, 27136, 27136, 27136, 5376, 28416, 28672, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136,
+					27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136,
+					27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 5376, 5376, 28928, 29184, 27136, 27136, 29440, 29696,
+					12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288,
+					12288, 12288, 12288, 12288, 12288, 12288, 12288, 29952, 12288, 12288, 12288, 30208, 30464, 30720, 27136, 27136,
+					27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136,
+					27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 30976,
+					12288, 31232, 31488, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 31744, 27136, 27136, 27136,
+					27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 32000,
+					32256, 32512, 32768, 33024, 33280, 33536, 33792, 34048, 5376, 5376, 34304, 27136, 27136, 27136, 27136, 34560,
+					34816, 35072, 35328, 27136, 35584, 27136, 27136, 35840, 36096, 36352, 27136, 27136, 36608, 36864, 37120, 27136,
+					37376, 37632, 37888, 38144, 38400, 38656, 38912, 39168, 39424, 39680, 39936, 40192, 40448, 40448, 40448, 40704,
+					12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288,
+					12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288,
+					12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288,
+					12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288,
+					12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288,
+					12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288,
+					12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288,
+					12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288,
+					12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288,
+					12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288,
+					12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288,
+					12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288,
+					12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288,
+					12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288,
+					12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288,
+					12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 40960,
+					12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288,
+					12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288,
+					12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288,
+					12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288,
+					12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288,
+					12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288,
+					12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288,
+					12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288,
+					12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288,
+					12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288,
+					12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288,
+					12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288,
+					12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288,
+					12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288,
+					12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288,
+					12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 40960,
+					27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136,
+					27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136,
+					27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136,
+					27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136,
+					27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136,
+					27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136,
+					27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136,
+					27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136,
+					27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136,
+					27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136,
+					27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136,
+					27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136,
+					27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136,
+					27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136,
+					27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136,
+					27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136,
+					27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136,
+					27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136,
+					27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136,
+					27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136,
+					27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136,
+					27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136,
+					27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136,
+					27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136,
+					27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136,
+					27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136,
+					27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136,
+					27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136,
+					27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136,
+					27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136,
+					27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136,
+					27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136,
+					27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136,
+					27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136,
+					27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136,
+					27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136,
+					27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136,
+					27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136,
+					27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136,
+					27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136,
+					27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136,
+					27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136,
+					27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136,
+					27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136,
+					27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136,
+					27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136,
+					27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136,
+					27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136,
+					27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136,
+					27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136,
+					27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136,
+					27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136,
+					27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136,
+					27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136,
+					27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136,
+					27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136,
+					27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136,
+					27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136,
+					27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136,
+					27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136,
+					27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136,
+					27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136,
+					27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136,
+					27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136,
+					27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136,
+					27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136,
+					27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136,
+					27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136,
+					27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136,
+					27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136,
+					27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136,
+					27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136,
+					27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136,
+					27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136,
+					27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136,
+					27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136,
+					27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136,
+					27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136,
+					27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136,
+					27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136,
+					27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136,
+					27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136,
+					27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136,
+					27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136,
+					27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136,
+					27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136,
+					27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136,
+					27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136,
+					27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136,
+					27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136,
+					27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136,
+					27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136,
+					27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136,
+					27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136,
+					27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136,
+					27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136,
+					27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136,
+					27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136,
+					27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136,
+					27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136,
+					27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136,
+					27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136,
+					27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136,
+					27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136,
+					27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136,
+					27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136,
+					27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136,
+					27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136,
+					27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136,
+					27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136,
+					27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136,
+					27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136,
+					27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136,
+					27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136,
+					27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136,
+					27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136,
+					27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136,
+					27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136,
+					27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136,
+					27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136,
+					27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136,
+					27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136,
+					27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136,
+					27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136,
+					27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136,
+					27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136,
+					27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136,
+					27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136,
+					27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136,
+					27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136,
+					27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136,
+					27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136,
+					27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136,
+					27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136,
+					27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136,
+					27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136,
+					27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136,
+					27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136,
+					27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136,
+					27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136,
+					27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136,
+					27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136,
+					27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136,
+					27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136,
+					27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136,
+					27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136,
+					27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136,
+					27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136,
+					27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136,
+					27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136,
+					27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136,
+					27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136,
+					27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136,
+					27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136,
+					27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136,
+					27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136,
+					27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136,
+					27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136,
+					27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136,
+					27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136,
+					41216, 41472, 41728, 41728, 41728, 41728, 41728, 41728, 41728, 41728, 41728, 41728, 41728, 41728, 41728, 41728,
+					27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136,
+					27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136,
+					27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136,
+					27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136,
+					27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136,
+					27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136,
+					27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136,
+					27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136,
+					27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136,
+					27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136,
+					27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136,
+					27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136,
+					27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136,
+					27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136,
+					27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136, 27136,
+					17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152,
+					17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152,
+					17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152,
+					17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152,
+					17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152,
+					17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152,
+					17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152,
+					17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152,
+					17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152,
+					17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152,
+					17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152,
+					17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152,
+					17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152,
+					17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152,
+					17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152,
+					17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 41984,
+					17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152,
+					17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152,
+					17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152,
+					17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152,
+					17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152,
+					17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152,
+					17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152,
+					17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152,
+					17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152,
+					17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152,
+					17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152,
+					17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152,
+					17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152,
+					17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152,
+					17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152,
+					17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 17152, 41984,
+				};
+
+				constinit const uint16 PropertyTable::Stage2[] = {
+					73, 73, 73, 73, 73, 73, 73, 73, 73, 68, 337, 70, 70, 138, 73, 73,
+					73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73,
+					8218, 8203, 8215, 8194, 8214, 8213, 8194, 8215, 8212, 8228, 8194, 8214, 8208, 8205, 8208, 8219,
+					8211, 8211, 8211, 8211, 8211, 8211, 8211, 8211, 8211, 8211, 8208, 8208, 8194, 8194, 8194, 8203,
+					8194, 8194, 8194, 8194, 8194, 8194, 8194, 8194, 8194, 8194, 8194, 8194, 8194, 8194, 8194, 8194,
+					8194, 8194, 8194, 8194, 8194, 8194, 8194, 8194, 8194, 8194, 8194, 8212, 8214, 8228, 8194, 8194,
+					8194, 8194, 8194, 8194, 8194, 8194, 8194, 8194, 8194, 8194, 8194, 8194, 8194, 8194, 8194, 8194,
+					8194, 8194, 8194, 8194, 8194, 8194, 8194, 8194, 8194, 8194, 8194, 8212, 8196, 8200, 8194, 73,
+					73, 73, 73, 73, 73, 93, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73,
+					73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73,
+					12, 2068, 8213, 8214, 2070, 8214, 8194, 2049, 2049, 2, 2049, 23, 8194, 2116, 2050, 8194,
+					2069, 2070, 2049, 2049, 2053, 2, 2049, 2049, 2049, 2049, 2049, 23, 2049, 2049, 2049, 2068,
+					2, 2, 2, 2, 2, 2, 2050, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2050, 2, 2, 2, 2, 2, 2, 2049, 2050, 2, 2, 2, 2, 2, 2050, 2050,
+					2050, 2050, 2, 2, 2, 2, 2050, 2, 2050, 2050, 2050, 2, 2050, 2050, 2, 2,
+					2050, 2, 2050, 2050, 2, 2, 2, 2049, 2050, 2050, 2050, 2, 2050, 2, 2050, 2,
+					2, 2050, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2050, 2, 2050, 2, 2, 2, 2, 2, 2, 2, 2050, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2050, 2050, 2, 2, 2, 2050, 2, 2, 2, 2,
+					2, 2050, 2050, 2050, 2, 2, 2, 2, 2050, 2, 2, 2, 2, 2, 2, 2050,
+					2050, 2050, 2050, 2, 2050, 2, 2, 2, 2050, 2050, 2050, 2050, 2, 2050, 2, 2,
+					2, 2, 2050, 2050, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2050, 2050, 2, 2, 2, 2050, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2050, 2,
+					2050, 2, 2050, 2, 2050, 2, 2050, 2, 2050, 2, 2050, 2, 2050, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2050, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2050, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2050, 2, 2, 2049, 5, 2049, 2049, 2049, 5, 2049, 2, 2,
+					2049, 2, 2, 2, 2, 2, 2, 2, 2049, 2049, 2049, 2049, 2, 2049, 2, 2053,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2249, 2249, 2249, 2249, 2249, 2249, 2249, 2249, 2249, 2249, 2249, 2249, 2249, 2249, 2249, 2249,
+					2249, 2249, 2249, 2249, 2249, 2249, 2249, 2249, 2249, 2249, 2249, 2249, 2249, 2249, 2249, 2249,
+					2249, 2249, 2249, 2249, 2249, 2249, 2249, 2249, 2249, 2249, 2249, 2249, 2249, 2249, 2249, 2249,
+					2249, 2249, 2249, 2249, 2249, 2249, 2249, 2249, 2249, 2249, 2249, 2249, 2249, 2249, 2249, 2249,
+					2249, 2249, 2249, 2249, 2249, 2249, 2249, 2249, 2249, 2249, 2249, 2249, 2249, 2249, 2249, 2252,
+					2249, 2249, 2249, 2249, 2249, 2249, 2249, 2249, 2249, 2249, 2249, 2249, 2252, 2252, 2252, 2252,
+					2252, 2252, 2252, 2249, 2249, 2249, 2249, 2249, 2249, 2249, 2249, 2249, 2249, 2249, 2249, 2249,
+					2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 2, 2, 2, 2, 16, 2,
+					0, 0, 0, 0, 2, 2, 2, 2, 2, 2, 2, 0, 2, 0, 2, 2,
+					2, 2050, 2050, 2050, 2050, 2050, 2050, 2050, 2050, 2050, 2050, 2050, 2050, 2050, 2050, 2050,
+					2050, 2050, 0, 2050, 2050, 2050, 2050, 2050, 2050, 2050, 2, 2, 2, 2, 2, 2,
+					2, 2050, 2050, 2050, 2050, 2050, 2050, 2050, 2050, 2050, 2050, 2050, 2050, 2050, 2050, 2050,
+					2050, 2050, 2, 2050, 2050, 2050, 2050, 2050, 2050, 2050, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2050, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2050, 2050, 2050, 2050, 2050, 2050, 2050, 2050, 2050, 2050, 2050, 2050, 2050, 2050, 2050, 2050,
+					2050, 2050, 2050, 2050, 2050, 2050, 2050, 2050, 2050, 2050, 2050, 2050, 2050, 2050, 2050, 2050,
+					2050, 2050, 2050, 2050, 2050, 2050, 2050, 2050, 2050, 2050, 2050, 2050, 2050, 2050, 2050, 2050,
+					2050, 2050, 2050, 2050, 2050, 2050, 2050, 2050, 2050, 2050, 2050, 2050, 2050, 2050, 2050, 2050,
+					2, 2050, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 201, 201, 201, 201, 201, 201, 201, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 0, 0, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 16, 4, 0, 0, 2, 2, 22,
+					0, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201,
+					201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201,
+					201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 4, 201,
+					2, 201, 201, 2, 201, 201, 11, 201, 0, 0, 0, 0, 0, 0, 0, 0,
+					38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+					38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 0, 0, 0, 0, 38,
+					38, 38, 38, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					706, 706, 706, 706, 706, 706, 2, 2, 2, 21, 21, 21, 16, 16, 2, 2,
+					201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 11, 73, 11, 11, 11,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 201, 201, 201, 201, 201,
+					201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201,
+					19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 21, 19, 19, 2, 2, 2,
+					201, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 11, 2, 201, 201, 201, 201, 201, 201, 201, 706, 2, 201,
+					201, 201, 201, 201, 201, 2, 2, 201, 201, 2, 201, 201, 201, 201, 2, 2,
+					19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 706,
+					2, 201, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201,
+					201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 0, 0, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201,
+					201, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 201, 201, 201, 201, 201,
+					201, 201, 201, 201, 2, 2, 2, 2, 16, 11, 2, 0, 0, 201, 22, 22,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 201, 201, 201, 201, 2, 201, 201, 201, 201, 201,
+					201, 201, 201, 201, 2, 201, 201, 201, 2, 201, 201, 201, 201, 201, 0, 0,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 201, 201, 201, 0, 0, 2, 0,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0,
+					706, 706, 0, 0, 0, 0, 0, 0, 201, 201, 201, 201, 201, 201, 201, 201,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 201, 201, 201, 201, 201, 201,
+					201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201,
+					201, 201, 706, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201,
+					201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201,
+					201, 201, 201, 649, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 201, 649, 201, 2, 649, 649,
+					649, 201, 201, 201, 201, 201, 201, 201, 201, 649, 649, 649, 649, 201, 649, 649,
+					2, 201, 201, 201, 201, 201, 201, 201, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 201, 201, 4, 4, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 201, 649, 649, 0, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 2,
+					2, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 2, 2, 2, 2, 2, 2,
+					2, 0, 2, 0, 0, 0, 2, 2, 2, 2, 0, 0, 201, 2, 201, 649,
+					649, 201, 201, 201, 201, 0, 0, 649, 649, 0, 0, 649, 649, 201, 2, 0,
+					0, 0, 0, 0, 0, 0, 0, 201, 0, 0, 0, 0, 2, 2, 0, 2,
+					2, 2, 201, 201, 0, 0, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+					2, 2, 21, 21, 2, 2, 2, 2, 2, 21, 2, 22, 2, 2, 201, 0,
+					0, 201, 201, 649, 0, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0, 2,
+					2, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 2, 2, 2, 2, 2, 2,
+					2, 0, 2, 2, 0, 2, 2, 0, 2, 2, 0, 0, 201, 0, 649, 649,
+					649, 201, 201, 0, 0, 0, 0, 201, 201, 0, 0, 201, 201, 201, 0, 0,
+					0, 201, 0, 0, 0, 0, 0, 0, 0, 2, 2, 2, 2, 0, 2, 0,
+					0, 0, 0, 0, 0, 0, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+					201, 201, 2, 2, 2, 201, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 201, 201, 649, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 2,
+					2, 2, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 2, 2, 2, 2, 2, 2,
+					2, 0, 2, 2, 0, 2, 2, 2, 2, 2, 0, 0, 201, 2, 649, 649,
+					649, 201, 201, 201, 201, 201, 0, 201, 201, 649, 0, 649, 649, 201, 0, 0,
+					2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					2, 2, 201, 201, 0, 0, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+					2, 22, 0, 0, 0, 0, 0, 0, 0, 2, 201, 201, 201, 201, 201, 201,
+					0, 201, 649, 649, 0, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 2,
+					2, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 2, 2, 2, 2, 2, 2,
+					2, 0, 2, 2, 0, 2, 2, 2, 2, 2, 0, 0, 201, 2, 201, 201,
+					649, 201, 201, 201, 201, 0, 0, 649, 649, 0, 0, 649, 649, 201, 0, 0,
+					0, 0, 0, 0, 0, 201, 201, 201, 0, 0, 0, 0, 2, 2, 0, 2,
+					2, 2, 201, 201, 0, 0, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+					2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 201, 2, 0, 2, 2, 2, 2, 2, 2, 0, 0, 0, 2, 2,
+					2, 0, 2, 2, 2, 2, 0, 0, 0, 2, 2, 0, 2, 0, 2, 2,
+					0, 0, 0, 2, 2, 0, 0, 0, 2, 2, 2, 0, 0, 0, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0, 201, 649,
+					201, 649, 649, 0, 0, 0, 649, 649, 649, 0, 649, 649, 649, 201, 0, 0,
+					2, 0, 0, 0, 0, 0, 0, 201, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 22, 2, 0, 0, 0, 0, 0,
+					201, 649, 649, 649, 201, 2, 2, 2, 2, 2, 2, 2, 2, 0, 2, 2,
+					2, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 201, 2, 201, 201,
+					201, 649, 649, 649, 649, 0, 201, 201, 201, 0, 201, 201, 201, 201, 0, 0,
+					0, 0, 0, 0, 0, 201, 201, 0, 2, 2, 2, 0, 0, 2, 0, 0,
+					2, 2, 201, 201, 0, 0, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+					0, 0, 0, 0, 0, 0, 0, 5, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 201, 649, 649, 5, 2, 2, 2, 2, 2, 2, 2, 2, 0, 2, 2,
+					2, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 0, 2, 2, 2, 2, 2, 0, 0, 201, 2, 649, 201,
+					649, 649, 201, 649, 649, 0, 201, 649, 649, 0, 649, 649, 201, 201, 0, 0,
+					0, 0, 0, 0, 0, 201, 201, 0, 0, 0, 0, 0, 0, 2, 2, 0,
+					2, 2, 201, 201, 0, 0, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+					0, 2, 2, 649, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					201, 201, 649, 649, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 2, 2,
+					2, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 201, 201, 2, 201, 649,
+					649, 201, 201, 201, 201, 0, 649, 649, 649, 0, 649, 649, 649, 201, 706, 2,
+					0, 0, 0, 0, 2, 2, 2, 201, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 201, 201, 0, 0, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 21, 2, 2, 2, 2, 2, 2,
+					0, 201, 649, 649, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 2, 0, 0,
+					2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 201, 0, 0, 0, 0, 201,
+					649, 649, 201, 201, 201, 0, 201, 0, 649, 649, 649, 649, 649, 649, 649, 201,
+					0, 0, 0, 0, 0, 0, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+					0, 0, 649, 649, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24,
+					24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24,
+					24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24,
+					24, 216, 24, 664, 216, 216, 216, 216, 216, 216, 216, 0, 0, 0, 0, 22,
+					24, 24, 24, 24, 24, 24, 24, 216, 216, 216, 216, 216, 216, 216, 216, 2,
+					19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 4, 4, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 24, 24, 0, 24, 0, 24, 24, 24, 24, 24, 0, 24, 24, 24, 24,
+					24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24,
+					24, 24, 24, 24, 0, 24, 0, 24, 24, 24, 24, 24, 24, 24, 24, 24,
+					24, 216, 24, 664, 216, 216, 216, 216, 216, 216, 216, 216, 216, 24, 0, 0,
+					24, 24, 24, 24, 24, 0, 24, 0, 216, 216, 216, 216, 216, 216, 216, 0,
+					19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 0, 0, 24, 24, 24, 24,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					2, 5, 5, 5, 5, 2, 5, 5, 12, 5, 5, 4, 12, 11, 11, 11,
+					11, 11, 12, 2, 11, 2, 2, 2, 201, 201, 2, 2, 2, 2, 2, 2,
+					19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 4, 201, 2, 201, 2, 201, 20, 8, 20, 8, 649, 649,
+					2, 2, 2, 2, 2, 2, 2, 2, 0, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0,
+					0, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 644,
+					201, 201, 201, 201, 201, 4, 201, 201, 2, 2, 2, 2, 2, 201, 201, 201,
+					201, 201, 201, 201, 201, 201, 201, 201, 0, 201, 201, 201, 201, 201, 201, 201,
+					201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201,
+					201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 0, 4, 4,
+					2, 2, 2, 2, 2, 2, 201, 2, 2, 2, 2, 2, 2, 0, 2, 2,
+					5, 5, 4, 5, 2, 2, 2, 2, 2, 12, 12, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24,
+					24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24,
+					24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 216, 216, 216,
+					216, 664, 216, 216, 216, 216, 216, 216, 24, 216, 216, 664, 664, 216, 216, 24,
+					19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 4, 4, 2, 2, 2, 2,
+					24, 24, 24, 24, 24, 24, 664, 664, 216, 216, 24, 24, 24, 24, 216, 216,
+					216, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24,
+					24, 216, 216, 216, 216, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24,
+					24, 24, 216, 24, 664, 216, 216, 24, 24, 24, 24, 24, 24, 216, 24, 24,
+					19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 24, 24, 24, 216, 24, 24,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 0, 2, 0, 0, 0, 0, 0, 2, 0, 0,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					10529, 10529, 10529, 10529, 10529, 10529, 10529, 10529, 10529, 10529, 10529, 10529, 10529, 10529, 10529, 10529,
+					10529, 10529, 10529, 10529, 10529, 10529, 10529, 10529, 10529, 10529, 10529, 10529, 10529, 10529, 10529, 10529,
+					10529, 10529, 10529, 10529, 10529, 10529, 10529, 10529, 10529, 10529, 10529, 10529, 10529, 10529, 10529, 10529,
+					10529, 10529, 10529, 10529, 10529, 10529, 10529, 10529, 10529, 10529, 10529, 10529, 10529, 10529, 10529, 10529,
+					10529, 10529, 10529, 10529, 10529, 10529, 10529, 10529, 10529, 10529, 10529, 10529, 10529, 10529, 10529, 10529,
+					10529, 10529, 10529, 10529, 10529, 10529, 10529, 10529, 10529, 10529, 10529, 10529, 10529, 10529, 10529, 10529,
+					611, 611, 611, 611, 611, 611, 611, 611, 611, 611, 611, 611, 611, 611, 611, 611,
+					611, 611, 611, 611, 611, 611, 611, 611, 611, 611, 611, 611, 611, 611, 611, 611,
+					611, 611, 611, 611, 611, 611, 611, 611, 611, 611, 611, 611, 611, 611, 611, 611,
+					611, 611, 611, 611, 611, 611, 611, 611, 611, 611, 611, 611, 611, 611, 611, 611,
+					611, 611, 611, 611, 611, 611, 611, 611, 546, 546, 546, 546, 546, 546, 546, 546,
+					546, 546, 546, 546, 546, 546, 546, 546, 546, 546, 546, 546, 546, 546, 546, 546,
+					546, 546, 546, 546, 546, 546, 546, 546, 546, 546, 546, 546, 546, 546, 546, 546,
+					546, 546, 546, 546, 546, 546, 546, 546, 546, 546, 546, 546, 546, 546, 546, 546,
+					546, 546, 546, 546, 546, 546, 546, 546, 546, 546, 546, 546, 546, 546, 546, 546,
+					546, 546, 546, 546, 546, 546, 546, 546, 546, 546, 546, 546, 546, 546, 546, 546,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 2, 2, 2, 2, 0, 0,
+					2, 2, 2, 2, 2, 2, 2, 0, 2, 0, 2, 2, 2, 2, 0, 0,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 2, 2, 2, 2, 0, 0,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 0, 2, 2, 2, 2, 0, 0, 2, 2, 2, 2, 2, 2, 2, 0,
+					2, 0, 2, 2, 2, 2, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 0, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 0, 2, 2, 2, 2, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 201, 201, 201,
+					2, 4, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 0, 0, 2, 2, 2, 2, 2, 2, 0, 0,
+					4, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					4, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 20, 8, 0, 0, 0,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 4, 4, 4, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 201, 201, 201, 649, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 201, 201, 649, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 201, 201, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 2, 2,
+					2, 0, 201, 201, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24,
+					24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24,
+					24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24,
+					24, 24, 24, 24, 216, 216, 664, 216, 216, 216, 216, 216, 216, 216, 664, 664,
+					664, 664, 664, 664, 664, 664, 216, 664, 664, 216, 216, 216, 216, 216, 216, 216,
+					216, 216, 216, 216, 4, 4, 18, 24, 4, 2, 4, 22, 24, 216, 0, 0,
+					19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 0, 0, 0, 0, 0, 0,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0,
+					2, 2, 11, 11, 4, 4, 5, 2, 11, 11, 2, 201, 201, 201, 76, 201,
+					19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 0, 0, 0, 0, 0, 0,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0,
+					2, 2, 2, 2, 2, 201, 201, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 201, 2, 0, 0, 0, 0, 0,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0,
+					201, 201, 201, 649, 649, 649, 649, 201, 201, 649, 649, 649, 0, 0, 0, 0,
+					649, 649, 201, 649, 649, 649, 649, 649, 649, 201, 201, 201, 0, 0, 0, 0,
+					2, 0, 0, 0, 11, 11, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+					24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24,
+					24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 0, 0,
+					24, 24, 24, 24, 24, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24,
+					24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24,
+					24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0,
+					24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24,
+					24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 0, 0,
+					19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 24, 0, 0, 0, 24, 24,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 201, 201, 649, 649, 201, 0, 0, 2, 2,
+					24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24,
+					24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24,
+					24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24,
+					24, 24, 24, 24, 24, 664, 216, 664, 216, 216, 216, 216, 216, 216, 216, 0,
+					216, 24, 216, 24, 24, 216, 216, 216, 216, 216, 216, 216, 216, 664, 664, 664,
+					664, 664, 664, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 0, 0, 201,
+					19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 0, 0, 0, 0, 0, 0,
+					19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 0, 0, 0, 0, 0, 0,
+					24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 0, 0,
+					201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201,
+					201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					201, 201, 201, 201, 649, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 201, 201, 201, 201, 201, 201, 201, 649, 201, 649, 649, 649,
+					649, 649, 201, 649, 649, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0,
+					19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 4, 4, 2, 4, 4, 4,
+					4, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 201, 201, 201, 201, 201,
+					201, 201, 201, 201, 2, 2, 2, 2, 2, 2, 2, 2, 2, 4, 4, 0,
+					201, 201, 649, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 649, 201, 201, 201, 201, 649, 649, 201, 201, 649, 201, 201, 201, 2, 2,
+					19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 201, 649, 201, 201, 649, 649, 649, 201, 649, 201,
+					201, 201, 649, 649, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 649, 649, 649, 649, 649, 649, 649, 649, 201, 201, 201, 201,
+					201, 201, 201, 201, 649, 649, 201, 201, 0, 0, 0, 4, 4, 4, 4, 4,
+					19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 0, 0, 0, 2, 2, 2,
+					19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 4, 4,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0,
+					201, 201, 201, 2, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201,
+					201, 649, 201, 201, 201, 201, 201, 201, 201, 2, 2, 2, 2, 201, 2, 2,
+					2, 2, 2, 2, 201, 2, 2, 649, 201, 201, 2, 0, 0, 0, 0, 0,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 204, 201, 201,
+					201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201,
+					201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201,
+					201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 204, 201, 201, 201,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 0, 0, 2, 2, 2, 2, 2, 2, 0, 0,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 0, 0, 2, 2, 2, 2, 2, 2, 0, 0,
+					2, 2, 2, 2, 2, 2, 2, 2, 0, 2, 0, 2, 0, 2, 0, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 0, 0, 2, 2, 2, 2, 2, 2, 0, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					0, 0, 2, 2, 2, 0, 2, 2, 2, 2, 2, 2, 2, 5, 2, 0,
+					4, 4, 4, 4, 4, 4, 4, 12, 4, 4, 4, 92, 201, 1130, 73, 73,
+					2052, 12, 4, 2052, 2051, 2049, 2049, 2, 2071, 2071, 20, 23, 2071, 2071, 20, 23,
+					2049, 2049, 2050, 2, 2063, 2063, 2063, 2052, 70, 70, 73, 73, 73, 73, 73, 12,
+					2069, 21, 2069, 2069, 21, 2069, 21, 21, 2, 23, 23, 2049, 18, 18, 2050, 2,
+					2, 2, 2, 2, 16, 20, 8, 18, 18, 18, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 4, 21, 4, 4, 4, 4, 2, 4, 4, 4,
+					94, 66, 66, 66, 66, 64, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73,
+					2, 2, 0, 0, 2049, 2, 2, 2, 2, 2, 2, 2, 2, 20, 8, 2049,
+					2, 2049, 2049, 2049, 2049, 2, 2, 2, 2, 2, 2, 2, 2, 20, 8, 0,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0,
+					22, 22, 22, 22, 22, 22, 22, 21, 22, 4118, 22, 22, 2070, 22, 22, 22,
+					22, 22, 22, 22, 22, 22, 21, 22, 22, 22, 22, 21, 22, 22, 21, 22,
+					21, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+					201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201,
+					201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201,
+					201, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					2, 2, 2, 2069, 2, 2049, 2, 2, 2, 2069, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2049, 2, 2, 2070, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2049, 2049, 2, 2, 2, 2050, 2, 2, 2, 2, 2049, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2050, 2049, 1, 2, 2, 2, 2, 2, 2049, 2050, 2050, 2049, 2,
+					2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2, 2, 2, 2,
+					2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2049, 2, 2, 0, 0, 0, 0,
+					2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2050, 2050, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2049, 2, 2049, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2050, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2049, 2, 2049, 2049, 2, 2, 2, 2049, 2049, 2, 2, 2049, 2, 2, 2, 2049,
+					2, 2049, 22, 22, 2, 2049, 2, 2, 2, 2, 2049, 2, 2, 2049, 2049, 2049,
+					2049, 2, 2, 2049, 2, 2049, 2, 2049, 2049, 2049, 2049, 2049, 2049, 2, 2049, 2,
+					2, 2, 2, 2, 2049, 2049, 2049, 2049, 2, 2, 2, 2, 2049, 2049, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2049, 2, 2, 2, 2049, 2, 2, 2,
+					2, 2, 2049, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2049, 2049, 2, 2, 2049, 2049, 2049, 2049, 2, 2, 2049, 2049, 2, 2, 2049, 2049,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2049, 2049, 2, 2, 2049, 2049, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2049, 2, 2, 2, 2049, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2049, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2049,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 15,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 20, 8, 20, 8, 2, 2, 2, 2,
+					2, 2, 2049, 2, 2, 2, 2, 2, 2, 2, 10254, 10254, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 10260, 10248, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 10242, 10242, 10242, 10242, 2, 2, 2,
+					10254, 14, 14, 10254, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049,
+					2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049,
+					2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049,
+					2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049,
+					2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049,
+					2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049,
+					2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049,
+					2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049,
+					2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 1, 2049, 2049, 2049, 2049, 2049,
+					2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2050,
+					2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049,
+					2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049,
+					2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049,
+					2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049,
+					2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2, 2, 2, 2,
+					2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049,
+					2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049,
+					2049, 2049, 2049, 2049, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049,
+					2, 2, 2049, 2049, 2049, 2049, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2049, 2049, 2, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2, 2, 2, 2, 2, 2,
+					2, 2, 2049, 2049, 2, 2, 2049, 2049, 2, 2, 2, 2, 2049, 2049, 2, 2,
+					2049, 2049, 2, 2, 2, 2, 2049, 2049, 2049, 2, 2, 2049, 2, 2, 2049, 2049,
+					2049, 2049, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2049, 2049, 2049, 2049, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2049,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 10242, 10242, 2,
+					14, 14, 14, 14, 2, 2049, 2049, 2, 2, 2049, 2, 2, 2, 2, 2049, 2049,
+					2, 2, 2, 2, 10254, 10254, 1, 1, 14, 2, 14, 14, 2062, 40, 2062, 14,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 14, 14, 14, 2, 2, 2, 2,
+					2049, 2, 2049, 2, 2, 2, 2, 2, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242,
+					10242, 10242, 10242, 10242, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2049, 2049, 2, 2049, 2049, 2049, 2, 2049, 2062, 2049, 2049, 2, 2049, 2049, 2, 2049,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 10254,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 10242, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2049, 2049,
+					2, 10242, 2, 2, 2, 2, 2, 2, 2, 2, 10242, 10242, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 10254, 10254, 2062,
+					14, 14, 14, 14, 10254, 10254, 2062, 2062, 2062, 2049, 2049, 2049, 2049, 2062, 10242, 2062,
+					2062, 2062, 2049, 2062, 10254, 2049, 2049, 2049, 2062, 2062, 2049, 2049, 2062, 2049, 2049, 2062,
+					2062, 2062, 2, 2049, 2, 2, 2, 2, 2049, 2049, 10254, 2049, 2049, 2049, 2049, 2049,
+					2049, 2062, 10254, 10254, 2062, 10254, 2049, 2062, 2062, 2088, 10254, 2049, 2049, 10254, 2062, 2062,
+					14, 14, 14, 14, 14, 10242, 2, 2, 14, 14, 10280, 10280, 40, 40, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 10242, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2050, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 10242, 2, 10242, 2,
+					2, 2, 2, 10242, 10242, 10242, 2, 10241, 2, 2, 2, 23, 23, 23, 23, 23,
+					23, 2, 11, 11, 14, 2, 2, 2, 20, 8, 20, 8, 20, 8, 20, 8,
+					20, 8, 20, 8, 20, 8, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049,
+					1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+					1, 1, 1, 1, 2, 10242, 10242, 10242, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					10242, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 10242,
+					2, 2, 2, 2, 2, 20, 8, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 8212, 8200, 8212, 8200, 8212, 8200, 8212, 8200, 20, 8,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 20, 8, 8212, 8200, 20, 8, 20, 8, 20, 8, 20, 8, 20,
+					8, 20, 8, 20, 8, 20, 8, 20, 8, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 20, 8, 20, 8, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 20, 8, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 10242, 10242, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					10242, 2, 2, 2, 2, 10241, 2049, 2049, 2049, 2049, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 201,
+					201, 201, 2, 2, 0, 0, 0, 0, 0, 11, 4, 4, 4, 2, 11, 4,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 0, 2, 0, 0, 0, 0, 0, 2, 0, 0,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 2,
+					4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 201,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					2, 2, 2, 2, 2, 2, 2, 0, 2, 2, 2, 2, 2, 2, 2, 0,
+					2, 2, 2, 2, 2, 2, 2, 0, 2, 2, 2, 2, 2, 2, 2, 0,
+					2, 2, 2, 2, 2, 2, 2, 0, 2, 2, 2, 2, 2, 2, 2, 0,
+					2, 2, 2, 2, 2, 2, 2, 0, 2, 2, 2, 2, 2, 2, 2, 0,
+					201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201,
+					201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201,
+					23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 4, 4,
+					4, 4, 4, 4, 4, 4, 2, 4, 20, 4, 2, 2, 23, 23, 2, 2,
+					23, 23, 20, 8, 20, 8, 20, 8, 20, 8, 4, 4, 4, 4, 11, 2,
+					4, 4, 2, 4, 4, 2, 2, 2, 2, 2, 3, 3, 4, 4, 4, 2,
+					4, 4, 20, 4, 4, 4, 4, 4, 4, 4, 4, 2, 4, 2, 4, 4,
+					2, 2, 2, 11, 11, 20, 8, 20, 8, 20, 8, 20, 8, 4, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 0, 10254, 10254, 10254, 10254, 10254,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254,
+					10254, 10254, 10254, 10254, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254,
+					10254, 10254, 10254, 10254, 10254, 10254, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 0, 0, 0, 0,
+					6148, 10248, 10248, 10254, 10254, 10258, 10254, 10254, 10260, 10248, 10260, 10248, 10260, 10248, 10260, 10248,
+					10260, 10248, 10254, 10254, 10260, 10248, 10260, 10248, 10260, 10248, 10260, 10248, 10258, 10260, 10248, 10248,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10441, 10441, 10441, 10441, 10441, 10441,
+					10254, 10254, 10254, 10254, 10254, 10249, 10254, 10254, 10254, 10254, 10254, 10258, 10258, 10254, 10254, 14,
+					0, 10277, 10254, 10277, 10254, 10277, 10254, 10277, 10254, 10277, 10254, 10254, 10254, 10254, 10254, 10254,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254,
+					10254, 10254, 10254, 10277, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254,
+					10254, 10254, 10254, 10277, 10254, 10277, 10254, 10277, 10254, 10254, 10254, 10254, 10254, 10254, 10277, 10254,
+					10254, 10254, 10254, 10254, 10254, 10277, 10277, 0, 0, 10441, 10441, 10258, 10258, 10258, 10258, 10254,
+					10258, 10277, 10254, 10277, 10254, 10277, 10254, 10277, 10254, 10277, 10254, 10254, 10254, 10254, 10254, 10254,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254,
+					10254, 10254, 10254, 10277, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254,
+					10254, 10254, 10254, 10277, 10254, 10277, 10254, 10277, 10254, 10254, 10254, 10254, 10254, 10254, 10277, 10254,
+					10254, 10254, 10254, 10254, 10254, 10277, 10277, 10254, 10254, 10254, 10254, 10258, 10277, 10258, 10258, 10254,
+					0, 0, 0, 0, 0, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254,
+					0, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 0,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254,
+					10254, 10254, 10254, 10254, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					10277, 10277, 10277, 10277, 10277, 10277, 10277, 10277, 10277, 10277, 10277, 10277, 10277, 10277, 10277, 10277,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 0,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254,
+					10254, 10254, 10254, 10254, 10254, 10258, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 0, 0, 0,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 4, 4,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 4, 11, 4,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 2, 2, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 201,
+					201, 201, 201, 2, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 201, 201,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					201, 201, 2, 4, 4, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0,
+					2, 2, 0, 2, 0, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 201, 2, 2, 2, 201, 2, 2, 2, 2, 201, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 649, 649, 201, 201, 649, 2, 2, 2, 2, 201, 0, 0, 0,
+					2, 2, 2, 2, 2, 2, 2, 2, 21, 2, 0, 0, 0, 0, 0, 0,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 5, 5, 11, 11, 0, 0, 0, 0, 0, 0, 0, 0,
+					649, 649, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 649, 649, 649, 649, 649, 649, 649, 649, 649, 649, 649, 649,
+					649, 649, 649, 649, 201, 201, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4,
+					19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 0, 0, 0, 0, 0, 0,
+					201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201,
+					201, 201, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 5, 2, 2, 201,
+					19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 201, 201, 201, 201, 201, 201, 201, 201, 4, 4,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 201, 201, 201, 201, 201, 201, 201, 201, 201,
+					201, 201, 649, 649, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2,
+					10529, 10529, 10529, 10529, 10529, 10529, 10529, 10529, 10529, 10529, 10529, 10529, 10529, 10529, 10529, 10529,
+					10529, 10529, 10529, 10529, 10529, 10529, 10529, 10529, 10529, 10529, 10529, 10529, 10529, 0, 0, 0,
+					201, 201, 201, 649, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 201, 649, 649, 201, 201, 201, 201, 649, 649, 201, 201, 649, 649,
+					649, 2, 2, 2, 2, 2, 2, 4, 4, 4, 2, 2, 2, 2, 0, 2,
+					19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 0, 0, 0, 0, 2, 2,
+					24, 24, 24, 24, 24, 216, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24,
+					19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 24, 24, 24, 24, 24, 0,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 201, 201, 201, 201, 201, 201, 649,
+					649, 201, 201, 649, 649, 201, 201, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					2, 2, 2, 201, 2, 2, 2, 2, 2, 2, 2, 2, 201, 649, 0, 0,
+					19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 0, 0, 2, 4, 4, 4,
+					24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24,
+					24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 216, 24, 24, 24,
+					24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24,
+					24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24,
+					24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24,
+					216, 24, 216, 216, 216, 24, 24, 216, 216, 24, 24, 24, 24, 24, 216, 216,
+					24, 216, 24, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 24, 24, 24, 24, 24,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 649, 201, 201, 649, 649,
+					4, 4, 2, 2, 2, 649, 201, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 2, 2, 2, 2, 2, 2, 0, 0, 2, 2, 2, 2, 2, 2, 0,
+					0, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					2, 2, 2, 2, 2, 2, 2, 0, 2, 2, 2, 2, 2, 2, 2, 0,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 649, 649, 201, 649, 649, 201, 649, 649, 4, 649, 201, 0, 0,
+					19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 0, 0, 0, 0, 0, 0,
+					10655, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720,
+					10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10655, 10720, 10720, 10720,
+					10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720,
+					10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10655, 10720, 10720, 10720, 10720, 10720, 10720, 10720,
+					10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720,
+					10720, 10720, 10720, 10720, 10655, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720,
+					10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720,
+					10655, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720,
+					10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10655, 10720, 10720, 10720,
+					10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720,
+					10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10655, 10720, 10720, 10720, 10720, 10720, 10720, 10720,
+					10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720,
+					10720, 10720, 10720, 10720, 10655, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720,
+					10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720,
+					10655, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720,
+					10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10655, 10720, 10720, 10720,
+					10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720,
+					10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10655, 10720, 10720, 10720, 10720, 10720, 10720, 10720,
+					10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720,
+					10720, 10720, 10720, 10720, 10655, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720,
+					10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720,
+					10655, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720,
+					10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10655, 10720, 10720, 10720,
+					10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720,
+					10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10655, 10720, 10720, 10720, 10720, 10720, 10720, 10720,
+					10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720,
+					10720, 10720, 10720, 10720, 10655, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720,
+					10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720,
+					10655, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720,
+					10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10655, 10720, 10720, 10720,
+					10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720,
+					10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10655, 10720, 10720, 10720, 10720, 10720, 10720, 10720,
+					10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720,
+					10720, 10720, 10720, 10720, 10655, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720,
+					10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720,
+					10655, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720,
+					10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10655, 10720, 10720, 10720,
+					10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720,
+					10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10655, 10720, 10720, 10720, 10720, 10720, 10720, 10720,
+					10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720,
+					10720, 10720, 10720, 10720, 10655, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720,
+					10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720,
+					10655, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720,
+					10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10655, 10720, 10720, 10720,
+					10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720,
+					10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10655, 10720, 10720, 10720, 10720, 10720, 10720, 10720,
+					10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720,
+					10720, 10720, 10720, 10720, 10655, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720,
+					10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720,
+					10655, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720,
+					10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10655, 10720, 10720, 10720,
+					10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720,
+					10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10655, 10720, 10720, 10720, 10720, 10720, 10720, 10720,
+					10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720,
+					10720, 10720, 10720, 10720, 10655, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720,
+					10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720,
+					10655, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720,
+					10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10655, 10720, 10720, 10720,
+					10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720,
+					10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10655, 10720, 10720, 10720, 10720, 10720, 10720, 10720,
+					10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720,
+					10720, 10720, 10720, 10720, 10655, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720,
+					10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720,
+					10655, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720,
+					10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10655, 10720, 10720, 10720,
+					10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720,
+					10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10655, 10720, 10720, 10720, 10720, 10720, 10720, 10720,
+					10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720,
+					10720, 10720, 10720, 10720, 10655, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720,
+					10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720,
+					10655, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720,
+					10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10655, 10720, 10720, 10720,
+					10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720,
+					10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10655, 10720, 10720, 10720, 10720, 10720, 10720, 10720,
+					10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720,
+					10720, 10720, 10720, 10720, 10655, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720,
+					10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720,
+					10655, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720,
+					10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10655, 10720, 10720, 10720,
+					10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720,
+					10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10655, 10720, 10720, 10720, 10720, 10720, 10720, 10720,
+					10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720,
+					10720, 10720, 10720, 10720, 10655, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720,
+					10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720,
+					10655, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720,
+					10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10655, 10720, 10720, 10720,
+					10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720,
+					10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10655, 10720, 10720, 10720, 10720, 10720, 10720, 10720,
+					10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720,
+					10720, 10720, 10720, 10720, 10655, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720,
+					10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720,
+					10655, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720,
+					10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10655, 10720, 10720, 10720,
+					10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720,
+					10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10655, 10720, 10720, 10720, 10720, 10720, 10720, 10720,
+					10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720,
+					10720, 10720, 10720, 10720, 10655, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720,
+					10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720,
+					10655, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720,
+					10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10655, 10720, 10720, 10720,
+					10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720,
+					10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10655, 10720, 10720, 10720, 10720, 10720, 10720, 10720,
+					10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720,
+					10720, 10720, 10720, 10720, 10655, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720,
+					10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720,
+					10655, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720,
+					10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10655, 10720, 10720, 10720,
+					10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720,
+					10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10655, 10720, 10720, 10720, 10720, 10720, 10720, 10720,
+					10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720,
+					10720, 10720, 10720, 10720, 10655, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720,
+					10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720,
+					10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720,
+					10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10655, 10720, 10720, 10720, 10720, 10720, 10720, 10720,
+					10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720,
+					10720, 10720, 10720, 10720, 10655, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720,
+					10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720,
+					10655, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720,
+					10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10655, 10720, 10720, 10720,
+					10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720,
+					10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10655, 10720, 10720, 10720, 10720, 10720, 10720, 10720,
+					10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720, 10720,
+					10720, 10720, 10720, 10720, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					611, 611, 611, 611, 611, 611, 611, 611, 611, 611, 611, 611, 611, 611, 611, 611,
+					611, 611, 611, 611, 611, 611, 611, 0, 0, 0, 0, 546, 546, 546, 546, 546,
+					546, 546, 546, 546, 546, 546, 546, 546, 546, 546, 546, 546, 546, 546, 546, 546,
+					546, 546, 546, 546, 546, 546, 546, 546, 546, 546, 546, 546, 546, 546, 546, 546,
+					546, 546, 546, 546, 546, 546, 546, 546, 546, 546, 546, 546, 0, 0, 0, 0,
+					25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+					25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+					25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+					25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+					25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+					25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+					25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+					25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+					25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+					25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+					25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+					25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+					25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+					25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+					25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+					25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+					2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048,
+					2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048,
+					2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048,
+					2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048,
+					2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048,
+					2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048,
+					2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048,
+					2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048,
+					2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048,
+					2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048,
+					2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048,
+					2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048,
+					2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048,
+					2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048,
+					2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048,
+					2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048,
+					2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0, 38, 201, 38,
+					38, 38, 38, 38, 38, 38, 38, 38, 38, 2, 38, 38, 38, 38, 38, 38,
+					38, 38, 38, 38, 38, 38, 38, 0, 38, 38, 38, 38, 38, 0, 38, 0,
+					38, 38, 0, 38, 38, 0, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 8, 20,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 2,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 21, 2, 2, 2,
+					2249, 2249, 2249, 2249, 2249, 2249, 2249, 2249, 2249, 2249, 2249, 2249, 2249, 2249, 2249, 2249,
+					10256, 10248, 10248, 10256, 10256, 10251, 10251, 10260, 10248, 10255, 0, 0, 0, 0, 0, 0,
+					201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201,
+					10254, 10254, 10254, 10254, 10254, 10260, 10248, 10260, 10248, 10260, 10248, 10260, 10248, 10260, 10248, 10260,
+					10248, 10260, 10248, 10260, 10248, 10254, 10254, 10260, 10248, 10254, 10254, 10254, 10254, 10254, 10254, 10254,
+					10248, 10254, 10248, 0, 10258, 10258, 10251, 10251, 10254, 10260, 10248, 10260, 10248, 10260, 10248, 10254,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 0, 10254, 10262, 10261, 10254, 0, 0, 0, 0,
+					2, 2, 2, 2, 2, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 94,
+					0, 6155, 6158, 6158, 6166, 6165, 6158, 6158, 6164, 6152, 6158, 6158, 6152, 6158, 6152, 6158,
+					6158, 6158, 6158, 6158, 6158, 6158, 6158, 6158, 6158, 6158, 6162, 6162, 6158, 6158, 6158, 6155,
+					6158, 6158, 6158, 6158, 6158, 6158, 6158, 6158, 6158, 6158, 6158, 6158, 6158, 6158, 6158, 6158,
+					6158, 6158, 6158, 6158, 6158, 6158, 6158, 6158, 6158, 6158, 6158, 6164, 6158, 6152, 6158, 6158,
+					6158, 6158, 6158, 6158, 6158, 6158, 6158, 6158, 6158, 6158, 6158, 6158, 6158, 6158, 6158, 6158,
+					6158, 6158, 6158, 6158, 6158, 6158, 6158, 6158, 6158, 6158, 6158, 6164, 6158, 6152, 6158, 6164,
+					6152, 4104, 4116, 4104, 4104, 4114, 4110, 4133, 4133, 4133, 4133, 4133, 4133, 4133, 4133, 4133,
+					4133, 4110, 4110, 4110, 4110, 4110, 4110, 4110, 4110, 4110, 4110, 4110, 4110, 4110, 4110, 4110,
+					4110, 4110, 4110, 4110, 4110, 4110, 4110, 4110, 4110, 4110, 4110, 4110, 4110, 4110, 4110, 4110,
+					4110, 4110, 4110, 4110, 4110, 4110, 4110, 4110, 4110, 4110, 4110, 4110, 4110, 4110, 4306, 4306,
+					4110, 4110, 4110, 4110, 4110, 4110, 4110, 4110, 4110, 4110, 4110, 4110, 4110, 4110, 4110, 4110,
+					4110, 4110, 4110, 4110, 4110, 4110, 4110, 4110, 4110, 4110, 4110, 4110, 4110, 4110, 4110, 0,
+					0, 0, 4110, 4110, 4110, 4110, 4110, 4110, 0, 0, 4110, 4110, 4110, 4110, 4110, 4110,
+					0, 0, 4110, 4110, 4110, 4110, 4110, 4110, 0, 0, 4110, 4110, 4110, 0, 0, 0,
+					6165, 6166, 6158, 6158, 6158, 6166, 6166, 0, 4098, 4098, 4098, 4098, 4098, 4098, 4098, 0,
+					64, 64, 64, 64, 64, 64, 64, 64, 64, 73, 73, 73, 7, 2049, 0, 0,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 0, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 2, 2, 0, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0,
+					4, 4, 4, 0, 0, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 0, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0,
+					2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 201, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					201, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 201, 201, 201, 201, 201, 0, 0, 0, 0, 0,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 4,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 0, 0, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2,
+					4, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0,
+					19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 0, 0, 0, 0, 0, 0,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 0, 0, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 2, 2, 2, 2,
+					2, 2, 2, 0, 2, 2, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 0, 2, 2, 2, 2, 2, 2, 2, 0, 2, 2, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					2, 2, 2, 2, 2, 2, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					2, 2, 2, 2, 2, 2, 0, 0, 2, 0, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 0, 2, 2, 0, 0, 0, 2, 0, 0, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 0, 4, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0,
+					0, 0, 0, 0, 0, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 0, 2, 2, 0, 0, 0, 0, 0, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 4,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0, 2,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 201, 201, 201, 0, 201, 201, 0, 0, 0, 0, 0, 201, 201, 201, 201,
+					2, 2, 2, 2, 0, 2, 2, 2, 0, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 0, 0, 201, 201, 201, 0, 0, 0, 0, 201,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0,
+					4, 4, 4, 4, 4, 4, 4, 4, 2, 0, 0, 0, 0, 0, 0, 0,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 201, 201, 0, 0, 0, 0, 2, 2, 2, 2, 2,
+					4, 4, 4, 4, 4, 4, 15, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 0, 0, 0, 4, 4, 4, 4, 4, 4, 4,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 0, 0, 0, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 0, 0, 0, 0, 0, 0, 0, 2, 2, 2, 2, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 2, 2, 2, 2, 2,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 201, 201, 201, 201, 0, 0, 0, 0, 0, 0, 0, 0,
+					19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 201, 201, 4, 0, 0,
+					2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 201, 201, 201,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201,
+					201, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 201, 201, 201, 201, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					649, 201, 649, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 201, 201, 201, 201, 201, 201, 201, 201,
+					201, 201, 201, 201, 201, 201, 201, 4, 4, 2, 2, 2, 2, 2, 0, 0,
+					0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+					201, 2, 2, 201, 201, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 201,
+					201, 201, 649, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					649, 649, 649, 201, 201, 201, 201, 649, 649, 201, 201, 2, 2, 706, 4, 4,
+					4, 4, 201, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 706, 0, 0,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0,
+					19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 0, 0, 0, 0, 0, 0,
+					201, 201, 201, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 201, 201, 201, 201, 201, 649, 201, 201, 201,
+					201, 201, 201, 201, 201, 0, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+					4, 4, 4, 4, 2, 649, 649, 2, 0, 0, 0, 0, 0, 0, 0, 0,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 201, 2, 5, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					201, 201, 649, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 649, 649, 649, 201, 201, 201, 201, 201, 201, 201, 201, 201, 649,
+					649, 2, 706, 706, 2, 4, 4, 2, 4, 201, 201, 201, 201, 2, 649, 201,
+					19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 2, 5, 2, 4, 4, 4,
+					0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 649, 649, 649, 201,
+					201, 201, 649, 649, 201, 649, 201, 201, 4, 4, 2, 4, 4, 2, 201, 2,
+					2, 201, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					2, 2, 2, 2, 2, 2, 2, 0, 2, 0, 2, 2, 2, 2, 0, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 4, 0, 0, 0, 0, 0, 0,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 201,
+					649, 649, 649, 201, 201, 201, 201, 201, 201, 201, 201, 0, 0, 0, 0, 0,
+					19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 0, 0, 0, 0, 0, 0,
+					201, 201, 649, 649, 0, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 2,
+					2, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 2, 2, 2, 2, 2, 2,
+					2, 0, 2, 2, 0, 2, 2, 2, 2, 2, 0, 201, 201, 2, 201, 649,
+					201, 649, 649, 649, 649, 0, 0, 649, 649, 0, 0, 649, 649, 649, 0, 0,
+					2, 0, 0, 0, 0, 0, 0, 201, 0, 0, 0, 0, 0, 2, 2, 2,
+					2, 2, 649, 649, 0, 0, 201, 201, 201, 201, 201, 201, 201, 0, 0, 0,
+					201, 201, 201, 201, 201, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 649, 649, 649, 201, 201, 201, 201, 201, 201, 201, 201,
+					649, 649, 201, 201, 201, 649, 201, 2, 2, 2, 2, 4, 4, 4, 4, 2,
+					19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 4, 4, 0, 2, 201, 2,
+					2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					201, 649, 649, 201, 201, 201, 201, 201, 201, 649, 201, 649, 649, 201, 649, 201,
+					201, 649, 201, 201, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0,
+					19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 201,
+					649, 649, 201, 201, 201, 201, 0, 0, 649, 649, 649, 649, 201, 201, 649, 201,
+					201, 5, 4, 4, 11, 11, 2, 2, 2, 4, 4, 4, 4, 4, 4, 4,
+					4, 4, 4, 4, 4, 4, 4, 4, 2, 2, 2, 2, 201, 201, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					649, 649, 649, 201, 201, 201, 201, 201, 201, 201, 201, 649, 649, 201, 649, 201,
+					201, 4, 4, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 0, 0, 0, 0, 0, 0,
+					5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 201, 649, 201, 649, 649,
+					201, 201, 201, 201, 201, 201, 649, 201, 2, 2, 0, 0, 0, 0, 0, 0,
+					19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24,
+					24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 0, 0, 216, 216, 216,
+					24, 24, 216, 216, 216, 216, 664, 216, 216, 216, 216, 216, 0, 0, 0, 0,
+					19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 24, 24, 4, 4, 4, 24,
+					24, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 649, 649, 649, 201,
+					201, 201, 201, 201, 201, 201, 201, 201, 649, 201, 201, 2, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2,
+					2, 2, 2, 2, 2, 2, 2, 0, 0, 2, 0, 0, 2, 2, 2, 2,
+					2, 2, 2, 2, 0, 2, 2, 0, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					201, 649, 649, 649, 649, 649, 0, 649, 649, 0, 0, 201, 201, 649, 201, 706,
+					649, 706, 649, 201, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 649, 649, 649, 201, 201, 201, 201, 0, 0, 201, 201, 649, 649, 649, 649,
+					201, 2, 5, 2, 649, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					2, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 201, 201, 201, 201, 201, 201, 649, 706, 201, 201, 201, 201, 5,
+					2, 4, 4, 4, 4, 5, 2, 201, 0, 0, 0, 0, 0, 0, 0, 0,
+					2, 201, 201, 201, 201, 201, 201, 649, 649, 201, 201, 201, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 706, 706, 706, 706, 706, 706, 201, 201, 201, 201, 201, 201,
+					201, 201, 201, 201, 201, 201, 201, 649, 201, 201, 4, 4, 4, 2, 5, 5,
+					5, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0,
+					5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 649,
+					201, 201, 201, 201, 201, 201, 201, 0, 201, 201, 201, 201, 201, 201, 649, 201,
+					2, 4, 4, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0,
+					5, 11, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					0, 0, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201,
+					201, 201, 201, 201, 201, 201, 201, 201, 0, 649, 201, 201, 201, 201, 201, 201,
+					201, 649, 201, 201, 649, 201, 201, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					2, 2, 2, 2, 2, 2, 2, 0, 2, 2, 0, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 201, 201, 201, 201, 201, 201, 0, 0, 0, 201, 0, 201, 201, 0, 201,
+					201, 201, 201, 201, 201, 201, 706, 201, 0, 0, 0, 0, 0, 0, 0, 0,
+					19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 0, 0, 0, 0, 0, 0,
+					2, 2, 2, 2, 2, 2, 0, 2, 2, 0, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 649, 649, 649, 649, 649, 0,
+					201, 201, 0, 649, 649, 201, 649, 201, 2, 0, 0, 0, 0, 0, 0, 0,
+					19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 201, 201, 649, 649, 2, 2, 0, 0, 0, 0, 0, 0, 0,
+					201, 201, 706, 649, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 649, 649, 201, 201, 201, 201, 201, 0, 0, 0, 649, 649,
+					201, 649, 201, 4, 4, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+					19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 21, 21, 21,
+					21, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0,
+					4, 4, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 20, 20, 20, 8, 8, 8, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 8, 2, 2, 2, 20, 8, 20, 8, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 20, 8, 8, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					76, 76, 76, 76, 76, 76, 76, 84, 72, 76, 76, 76, 84, 72, 84, 72,
+					201, 2, 2, 2, 2, 2, 2, 201, 201, 201, 201, 201, 201, 201, 201, 201,
+					201, 201, 201, 201, 201, 201, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 20, 8,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0,
+					19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 0, 0, 0, 0, 4, 4,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0,
+					19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 0, 0, 0, 0, 0, 0,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0,
+					201, 201, 201, 201, 201, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					201, 201, 201, 201, 201, 201, 201, 4, 4, 4, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 4, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 0, 2, 2, 2, 2, 2,
+					2, 2, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 4, 4, 2, 2, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0, 201,
+					2, 649, 649, 649, 649, 649, 649, 649, 649, 649, 649, 649, 649, 649, 649, 649,
+					649, 649, 649, 649, 649, 649, 649, 649, 649, 649, 649, 649, 649, 649, 649, 649,
+					649, 649, 649, 649, 649, 649, 649, 649, 649, 649, 649, 649, 649, 649, 649, 649,
+					649, 649, 649, 649, 649, 649, 649, 649, 0, 0, 0, 0, 0, 0, 0, 201,
+					201, 201, 201, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					10258, 10258, 10258, 10258, 10444, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					10889, 10889, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 0, 0, 0, 0, 0, 0, 0, 0,
+					10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242,
+					10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242,
+					10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242,
+					10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242,
+					10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242,
+					10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242,
+					10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242,
+					10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242,
+					10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242,
+					10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242,
+					10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242,
+					10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242,
+					10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242,
+					10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242,
+					10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242,
+					10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242,
+					10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242,
+					10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242,
+					10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242,
+					10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242,
+					10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242,
+					10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242,
+					10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242,
+					10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242,
+					10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242,
+					10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242,
+					10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242,
+					10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242,
+					10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242,
+					10242, 10242, 10242, 10242, 10242, 10242, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					10242, 10242, 10242, 10242, 0, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 0, 10242, 10242, 0,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254,
+					10254, 10254, 10254, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 10277, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					10277, 10277, 10277, 0, 0, 10277, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 10277, 10277, 10277, 10277, 0, 0, 0, 0, 0, 0, 0, 0,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 0, 0, 0, 0,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 2, 201, 201, 4,
+					73, 73, 73, 73, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201,
+					201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201,
+					201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 0, 0,
+					201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201,
+					201, 201, 201, 201, 201, 201, 201, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 0, 0, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 201, 649, 201, 201, 201, 2, 2, 2, 649, 201, 201,
+					201, 201, 201, 73, 73, 73, 73, 73, 73, 73, 73, 201, 201, 201, 201, 201,
+					201, 201, 201, 2, 2, 201, 201, 201, 201, 201, 201, 201, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 201, 201, 201, 201, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 201, 201, 201, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 2, 2,
+					0, 0, 2, 0, 0, 2, 2, 0, 0, 2, 2, 2, 2, 0, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 2, 0, 2, 2, 2,
+					2, 2, 2, 2, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 0, 2, 2, 2, 2, 0, 0, 2, 2, 2,
+					2, 2, 2, 2, 2, 0, 2, 2, 2, 2, 2, 2, 2, 0, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 2, 2, 2, 2, 0,
+					2, 2, 2, 2, 2, 0, 2, 0, 0, 0, 2, 2, 2, 2, 2, 2,
+					2, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 19, 19,
+					19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+					19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+					19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+					201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201,
+					201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201,
+					201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201,
+					201, 201, 201, 201, 201, 201, 201, 2, 2, 2, 2, 201, 201, 201, 201, 201,
+					201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201,
+					201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201,
+					201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 2, 2, 2,
+					2, 2, 2, 2, 2, 201, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 201, 2, 2, 4, 4, 4, 4, 2, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 201, 201, 201, 201, 201,
+					0, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0,
+					0, 0, 0, 0, 0, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					201, 201, 201, 201, 201, 201, 201, 0, 201, 201, 201, 201, 201, 201, 201, 201,
+					201, 201, 201, 201, 201, 201, 201, 201, 201, 0, 0, 201, 201, 201, 201, 201,
+					201, 201, 0, 201, 201, 0, 201, 201, 201, 201, 201, 0, 0, 0, 0, 0,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 201,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0,
+					201, 201, 201, 201, 201, 201, 201, 2, 2, 2, 2, 2, 2, 2, 0, 0,
+					19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 0, 0, 0, 0, 2, 2,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 201, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 201, 201, 201, 201,
+					19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 0, 0, 0, 0, 0, 22,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 201, 201, 201, 201,
+					19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					2, 2, 2, 2, 2, 2, 2, 0, 2, 2, 2, 2, 0, 2, 2, 0,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					201, 201, 201, 201, 201, 201, 201, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 201, 201, 201, 201, 201, 201, 201, 2, 0, 0, 0, 0,
+					19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 0, 0, 0, 0, 20, 20,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 21, 2, 2, 2,
+					21, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					2, 2, 2, 2, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					0, 2, 2, 0, 2, 0, 0, 2, 0, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 0, 2, 2, 2, 2, 0, 2, 0, 2, 0, 0, 0, 0,
+					0, 0, 2, 0, 0, 0, 0, 2, 0, 2, 0, 2, 0, 2, 2, 2,
+					0, 2, 2, 0, 2, 0, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2,
+					0, 2, 2, 0, 2, 0, 0, 2, 2, 2, 2, 0, 2, 2, 2, 2,
+					2, 2, 2, 0, 2, 2, 2, 2, 0, 2, 2, 2, 2, 0, 2, 0,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0,
+					0, 2, 2, 2, 0, 2, 2, 2, 2, 2, 0, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					14, 14, 14, 14, 10254, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+					14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+					14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+					14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+					14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+					14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+					14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+					14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+					14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+					14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+					14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+					14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+					14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 10254,
+					14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+					14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+					14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+					2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 1, 1, 14, 14, 14,
+					2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049,
+					2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2, 2,
+					2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049,
+					2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049,
+					2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049,
+					2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2, 2, 2, 14, 14, 14,
+					2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049,
+					2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 10241, 2049,
+					2049, 10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241, 10241, 2049, 2049, 2049, 2049, 2049,
+					2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 2049, 14, 14, 14,
+					14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+					14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+					14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+					14, 14, 14, 14, 14, 14, 807, 807, 807, 807, 807, 807, 807, 807, 807, 807,
+					807, 807, 807, 807, 807, 807, 807, 807, 807, 807, 807, 807, 807, 807, 807, 807,
+					10254, 10254, 10254, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 14, 14, 14, 14,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 14, 14, 14, 14, 14, 14, 14,
+					10254, 10254, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+					10254, 10254, 10254, 10254, 10254, 10254, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+					14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+					14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+					14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+					14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+					14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+					14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+					14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+					14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+					14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254,
+					10254, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 10254, 10254, 10254,
+					10254, 10254, 10254, 10254, 10254, 10254, 14, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 14, 10254, 10254,
+					10254, 10254, 10254, 10254, 10254, 10280, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254,
+					10254, 10254, 10254, 10254, 14, 14, 14, 14, 14, 14, 14, 14, 2, 2, 14, 14,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254,
+					10254, 10254, 10254, 10254, 10254, 10242, 10242, 10254, 10254, 10254, 10254, 10254, 10242, 10254, 10254, 10254,
+					10254, 10254, 10280, 10280, 10280, 10254, 10254, 10280, 10254, 10254, 10280, 40, 40, 14, 14, 10254,
+					10254, 10254, 10254, 10254, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254,
+					10254, 14, 14, 14, 10254, 14, 14, 14, 10254, 10254, 10254, 10473, 10473, 10473, 10473, 10473,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 14,
+					10254, 14, 10280, 10280, 10254, 10254, 10280, 10280, 10280, 10280, 10280, 10280, 10280, 10280, 10280, 10280,
+					10280, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254,
+					10254, 10254, 10254, 10254, 10254, 10254, 10280, 10280, 10280, 10280, 10280, 10280, 10280, 10280, 10280, 10280,
+					10280, 10280, 10280, 10280, 10280, 10280, 10280, 10280, 10280, 10254, 10254, 10254, 10280, 10254, 10254, 10254,
+					10254, 10280, 10280, 10280, 10254, 10280, 10280, 10280, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10280,
+					10254, 10280, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254,
+					10242, 10254, 10242, 10254, 10242, 10254, 10254, 10254, 10254, 10254, 10280, 10254, 10254, 10254, 10254, 10242,
+					10254, 10242, 10242, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 14, 14, 10254,
+					10242, 10242, 10242, 10242, 10242, 10242, 10242, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242,
+					10242, 10242, 10242, 10242, 10242, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254,
+					10254, 10254, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 10242, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 14, 10254, 10254, 10254, 10254, 14,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 14, 14, 14, 14, 14, 14, 14, 14,
+					14, 14, 14, 14, 40, 40, 14, 14, 14, 14, 10280, 14, 14, 14, 14, 14,
+					14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+					40, 14, 14, 14, 14, 10280, 10280, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+					14, 14, 14, 14, 10254, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+					14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+					14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+					14, 14, 14, 14, 2, 2, 2, 2, 2, 2, 2, 2, 14, 14, 14, 14,
+					14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+					14, 14, 14, 14, 2, 2, 2, 2, 2, 2, 14, 10254, 10254, 10254, 10254, 10254,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254,
+					10254, 10254, 10254, 10254, 10254, 10280, 10280, 10280, 10254, 10254, 10254, 10280, 10280, 10280, 10280, 10280,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 23, 23, 23, 18, 18, 18, 2, 2, 2, 2,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254,
+					10254, 10254, 10254, 10280, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254,
+					10254, 10254, 10254, 10254, 10280, 10280, 10280, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254,
+					10280, 10254, 10254, 10254, 10254, 10254, 14, 14, 14, 14, 14, 14, 10280, 14, 14, 14,
+					10254, 10254, 10254, 14, 14, 10254, 10254, 10254, 14, 14, 14, 14, 10254, 10254, 10254, 10254,
+					14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 10254, 10254, 14, 14, 14,
+					14, 14, 14, 14, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 14, 14, 14,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 14, 14, 14, 14,
+					10254, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 14, 14, 14, 14,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 14, 14, 14, 14, 14, 14, 14, 14,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 14, 14, 14, 14, 14, 14,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 14, 14, 14, 14, 14, 14, 14, 14,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 14, 14,
+					14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+					14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+					14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+					14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+					14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 10280, 10254, 10254, 10280,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10280, 10280, 10280, 10280, 10280, 10280, 10280, 10280,
+					10254, 10254, 10254, 10254, 10254, 10254, 10280, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254,
+					10280, 10280, 10280, 10280, 10280, 10280, 10280, 10280, 10280, 10280, 10254, 14, 10280, 10280, 10280, 10254,
+					10254, 10254, 10254, 10254, 10254, 10254, 14, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10280, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254,
+					10254, 10254, 10254, 10254, 10254, 10280, 10280, 10254, 10280, 10280, 10254, 10280, 10254, 10254, 10254, 10254,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10280, 10280, 10280,
+					10254, 10280, 10280, 10280, 10280, 10280, 10280, 10280, 10280, 10280, 10280, 10280, 10280, 10280, 10254, 10254,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+					14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 14, 14, 14,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 14, 14, 14, 14, 14, 14, 14,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 14, 10254,
+					10254, 10254, 10254, 10280, 10280, 10280, 14, 14, 14, 14, 14, 14, 14, 14, 10254, 10254,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 14, 14, 14, 14,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 14, 14, 14, 14, 14, 14, 14,
+					10280, 10280, 10280, 10280, 10280, 10280, 10280, 10280, 10280, 14, 14, 14, 14, 14, 14, 14,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+					2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 0, 0, 0, 0, 0, 0,
+					14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+					14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+					14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+					14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+					14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+					14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+					14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+					14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+					14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+					14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+					14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+					14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+					14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+					14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+					14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+					14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+					14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+					14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+					14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+					14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+					14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+					14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+					14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+					14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+					14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+					14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+					14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+					14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+					14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+					14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+					14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+					14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 0, 0,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254,
+					10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 10254, 0, 0,
+					64, 73, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64,
+					64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64,
+					201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201,
+					201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201,
+					201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201,
+					201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201,
+					201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201,
+					201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201,
+					64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64,
+					64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64,
+					64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64,
+					64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64,
+					64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64,
+					64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64,
+					64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64,
+					64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64,
+					2249, 2249, 2249, 2249, 2249, 2249, 2249, 2249, 2249, 2249, 2249, 2249, 2249, 2249, 2249, 2249,
+					2249, 2249, 2249, 2249, 2249, 2249, 2249, 2249, 2249, 2249, 2249, 2249, 2249, 2249, 2249, 2249,
+					2249, 2249, 2249, 2249, 2249, 2249, 2249, 2249, 2249, 2249, 2249, 2249, 2249, 2249, 2249, 2249,
+					2249, 2249, 2249, 2249, 2249, 2249, 2249, 2249, 2249, 2249, 2249, 2249, 2249, 2249, 2249, 2249,
+					2249, 2249, 2249, 2249, 2249, 2249, 2249, 2249, 2249, 2249, 2249, 2249, 2249, 2249, 2249, 2249,
+					2249, 2249, 2249, 2249, 2249, 2249, 2249, 2249, 2249, 2249, 2249, 2249, 2249, 2249, 2249, 2249,
+					2249, 2249, 2249, 2249, 2249, 2249, 2249, 2249, 2249, 2249, 2249, 2249, 2249, 2249, 2249, 2249,
+					2249, 2249, 2249, 2249, 2249, 2249, 2249, 2249, 2249, 2249, 2249, 2249, 2249, 2249, 2249, 2249,
+					2249, 2249, 2249, 2249, 2249, 2249, 2249, 2249, 2249, 2249, 2249, 2249, 2249, 2249, 2249, 2249,
+					2249, 2249, 2249, 2249, 2249, 2249, 2249, 2249, 2249, 2249, 2249, 2249, 2249, 2249, 2249, 2249,
+					2249, 2249, 2249, 2249, 2249, 2249, 2249, 2249, 2249, 2249, 2249, 2249, 2249, 2249, 2249, 2249,
+					2249, 2249, 2249, 2249, 2249, 2249, 2249, 2249, 2249, 2249, 2249, 2249, 2249, 2249, 2249, 2249,
+					2249, 2249, 2249, 2249, 2249, 2249, 2249, 2249, 2249, 2249, 2249, 2249, 2249, 2249, 2249, 2249,
+					2249, 2249, 2249, 2249, 2249, 2249, 2249, 2249, 2249, 2249, 2249, 2249, 2249, 2249, 2249, 2249,
+					2249, 2249, 2249, 2249, 2249, 2249, 2249, 2249, 2249, 2249, 2249, 2249, 2249, 2249, 2249, 2249,
+					64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64,
+					64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64,
+					64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64,
+					64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64,
+					64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64,
+					64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64,
+					64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64,
+					64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64,
+					64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64,
+					64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64,
+					64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64,
+					64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64,
+					64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64,
+					64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64,
+					64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64,
+					64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64,
+					64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64,
+					2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048,
+					2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048,
+					2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048,
+					2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048,
+					2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048,
+					2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048,
+					2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048,
+					2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048,
+					2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048,
+					2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048,
+					2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048,
+					2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048,
+					2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048,
+					2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048,
+					2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048,
+					2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 0, 0,
+				};
+			} // namespace detail
+		} // namespace Property
+	}     // namespace Unicode
+} // namespace tomolatoon
@@ -20,6 +20,126 @@ namespace tomolatoon
 		return false;
 	}
 
+	String ParallelForError::message() const
+	{
+		try
+		{
+			std::rethrow_exception(error);
+		}
+		catch (const Error& e)
+		{
+			return e.what();
+		}
+		catch (const std::exception& e)
+		{
+			return Unicode::Widen(e.what());
+		}
+		catch (...)
+		{
+			return U"unknown exception";
+		}
+	}
+
+	WorkerPool& WorkerPool::Shared()
+	{
+		static WorkerPool pool{Max<size_t>(std::thread::hardware_concurrency(), 1) - 1};
+		return pool;
+	}
+
+	WorkerPool::WorkerPool(size_t threads)
+	{
+		m_threads.reserve(threads);
+
+		for (size_t i = 0; i < threads; ++i)
+		{
+			m_threads.emplace_back([this](std::stop_token stop) { workerLoop(stop); });
+		}
+	}
+
+	WorkerPool::~WorkerPool()
+	{
+		for (auto&& thread : m_threads)
+		{
+			thread.request_stop();
+		}
+
+		m_wake.notify_all();
+	}
+
+	Array<ParallelForError> WorkerPool::run(size_t count, const std::function<void(size_t)>& func)
+	{
+		std::lock_guard runLock{m_runMutex};
+
+		{
+			std::lock_guard lock{m_mutex};
+			m_func  = &func;
+			m_count = count;
+			m_next  = 0;
+			m_errors.clear();
+			++m_generation;
+		}
+
+		m_wake.notify_all();
+
+		// 呼び出し元のスレッドも働く
+		work();
+
+		// 全てのインデックスを配り終えても、ワーカーが処理中のものがあれば待つ
+		std::unique_lock lock{m_mutex};
+		m_done.wait(lock, [this] { return m_working == 0; });
+
+		m_func = nullptr;
+
+		std::ranges::sort(m_errors, {}, &ParallelForError::index);
+
+		return std::exchange(m_errors, {});
+	}
+
+	void WorkerPool::work()
+	{
+		for (size_t i = m_next++; i < m_count; i = m_next++)
+		{
+			try
+			{
+				(*m_func)(i);
+			}
+			catch (...)
+			{
+				std::lock_guard lock{m_mutex};
+				m_errors.push_back(ParallelForError{i, std::current_exception()});
+			}
+		}
+	}
+
+	void WorkerPool::workerLoop(std::stop_token stop)
+	{
+		uint64 seen = 0;
+
+		while (true)
+		{
+			{
+				std::unique_lock lock{m_mutex};
+
+				if (not m_wake.wait(lock, stop, [&] { return m_generation != seen && m_func; }))
+				{
+					return;
+				}
+
+				seen = m_generation;
+				++m_working;
+			}
+
+			work();
+
+			{
+				std::lock_guard lock{m_mutex};
+				--m_working;
+			}
+
+			m_done.notify_all();
+		}
+	}
+
 	namespace Cursor
 	{
 		namespace
@@ -3,6 +3,12 @@
 #include <optional>
 #include <compare>
 #include <concepts>
+#include <thread>
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <exception>
 
 #include "Settings.hpp"
 
@@ -51,6 +57,62 @@ namespace tomolatoon
 		}
 	}
 
+	// ParallelFor で func が投げた例外と、その時のインデックス
+	struct ParallelForError
+	{
+		size_t             index;
+		std::exception_ptr error;
+
+		/// @brief 例外のメッセージ
+		String message() const;
+	};
+
+	// 作ったスレッドを使い回して、ParallelFor の呼び出しを分担する
+	// 1度に1つの呼び出ししか受け付けず、複数のスレッドから同時に呼ばれたら順番に処理する
+	struct WorkerPool
+	{
+		/// @brief プロセスで共有するプール。初めて呼ばれた時に hardware_concurrency() - 1 本のスレッドを作る
+		static WorkerPool& Shared();
+
+		explicit WorkerPool(size_t threads);
+
+		WorkerPool(const WorkerPool&)            = delete;
+		WorkerPool& operator=(const WorkerPool&) = delete;
+
+		~WorkerPool();
+
+		/// @brief [0, count) の各インデックスについて func を呼び出し、全て終わるまで待つ。呼び出し元のスレッドも働く
+		/// @return func が例外を投げたインデックスと例外。インデックス順
+		[[nodiscard]] Array<ParallelForError> run(size_t count, const std::function<void(size_t)>& func);
+
+	private:
+		void work();
+
+		void workerLoop(std::stop_token stop);
+
+		std::mutex                         m_runMutex   = {}; // run を1つずつにする
+		std::mutex                         m_mutex      = {};
+		std::condition_variable_any        m_wake       = {};
+		std::condition_variable            m_done       = {};
+		const std::function<void(size_t)>* m_func       = nullptr;
+		size_t                             m_count      = 0;
+		std::atomic<size_t>                m_next       = 0;
+		uint64                             m_generation = 0; // run の度に増える。ワーカーはこれを見て起きる
+		size_t                             m_working    = 0; // 今の run を処理中のワーカーの数
+		Array<ParallelForError>            m_errors     = {};
+		Array<std::jthread>                m_threads    = {};
+	};
+
+	/// @brief [0, count) の各インデックスについて func を呼び出す。呼び出しは WorkerPool::Shared() のスレッドに分散され、全て終わるまで返らない。
+	/// @param count 呼び出す回数
+	/// @param func size_t を受け取る関数。複数のスレッドから同時に呼ばれる
+	/// @return func が例外を投げたインデックスと例外。func が投げた例外はここで捕まえられ、他のインデックスの呼び出しは続けられる
+	template <std::invocable<size_t> Func>
+	[[nodiscard]] Array<ParallelForError> ParallelFor(size_t count, Func func)
+	{
+		return WorkerPool::Shared().run(count, std::function<void(size_t)>{std::ref(func)});
+	}
+
 	namespace Cursor
 	{
 		void Update() noexcept;
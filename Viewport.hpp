@@ -9,8 +9,49 @@ namespace tomolatoon
 {
 	namespace detail
 	{
+		// ScopedIframe2D と ScopedOffscreen2D が設定した Iframe 領域 (シーン座標) を積んでおく
+		// Graphics2D::GetViewport() を呼ばずに、一番上を読むだけで今の Iframe 領域が分かる
+		struct IframeStack
+		{
+			static void Push(const Rect& rect)
+			{
+				rects.push_back(rect);
+			}
+
+			static void Pop() noexcept
+			{
+				rects.pop_back();
+			}
+
+			static Rect Top() noexcept
+			{
+				// 何も積まれていない時だけ Siv3D に問い合わせる
+				return rects ? rects.back() : Graphics2D::GetViewport().value_or(Scene::Rect());
+			}
+
+		private:
+			inline static Array<Rect> rects = {};
+		};
+
+		// 基底クラスとして ScopedViewport2D の後に置き、ビューポートを設定している間だけ IframeStack に積む
+		struct ScopedIframeStackEntry
+		{
+			ScopedIframeStackEntry(const Rect& rect)
+			{
+				IframeStack::Push(rect);
+			}
+
+			ScopedIframeStackEntry(const ScopedIframeStackEntry&)            = delete;
+			ScopedIframeStackEntry& operator=(const ScopedIframeStackEntry&) = delete;
+
+			~ScopedIframeStackEntry()
+			{
+				IframeStack::Pop();
+			}
+		};
+
 		const auto ScopedIframe2DRect = [](const Rect newLocal, const bool isCropped = true, const bool isForceIntersects = true) {
-			const auto viewportGlobal  = Graphics2D::GetViewport().value_or(Scene::Rect());
+			const auto viewportGlobal  = IframeStack::Top();
 			const auto viewportLocal   = viewportGlobal.movedBy(-viewportGlobal.tl());
 			const auto newLocalAjusted = newLocal.stretched(newLocal.w == 0, newLocal.h == 0);
 			auto       resultNewLocal  = newLocalAjusted;
@@ -51,19 +92,63 @@ namespace tomolatoon
 
 	struct ScopedIframe2D
 		: s3d::ScopedViewport2D
+		, detail::ScopedIframeStackEntry
 		, s3d::Transformer2D
 	{
 		ScopedIframe2D(Rect rect, ScopedIframe2DCropped isCropped = ScopedIframe2DCropped::Yes, ScopedIframe2DForceIntersects isForceIntersects = ScopedIframe2DForceIntersects::Yes)
-			: s3d::ScopedViewport2D(detail::ScopedIframe2DRect(rect, isCropped.getBool(), isForceIntersects.getBool()))
+			: ScopedIframe2D(rect, detail::ScopedIframe2DRect(rect, isCropped.getBool(), isForceIntersects.getBool()))
+		{}
+
+	private:
+		ScopedIframe2D(const Rect& rect, const Rect& viewport)
+			: s3d::ScopedViewport2D(viewport)
+			, detail::ScopedIframeStackEntry(viewport)
 			, s3d::Transformer2D(Mat3x2::Identity(), Mat3x2::Translate(rect.tl()))
 		{}
 	};
 
+	/// @brief RenderTexture に描画する間、描画先を透明にクリアして、Iframe 領域と座標変換をその RenderTexture (の region の部分) に合わせる
+	/// 描画結果はアルファ乗算済みになるので、描画する時は BlendState::Premultiplied を使う
+	struct ScopedOffscreen2D
+		: s3d::ScopedRenderTarget2D
+		, s3d::ScopedViewport2D
+		, detail::ScopedIframeStackEntry
+		, s3d::Transformer2D
+		, s3d::ScopedRenderStates2D
+	{
+		ScopedOffscreen2D(const RenderTexture& rt)
+			: s3d::ScopedRenderTarget2D(rt.clear(ColorF{0.0, 0.0}))
+			, s3d::ScopedViewport2D(Rect{rt.size()})
+			, detail::ScopedIframeStackEntry(Rect{rt.size()})
+			, s3d::Transformer2D(Mat3x2::Identity(), Transformer2D::Target::SetLocal)
+			, s3d::ScopedRenderStates2D(PremultipliedAccumulation(), RasterizerState::Default2D)
+		{}
+
+		/// @param region rt の中で描画する部分。この部分だけがクリアされる
+		ScopedOffscreen2D(const RenderTexture& rt, const Rect& region)
+			: s3d::ScopedRenderTarget2D(rt)
+			, s3d::ScopedViewport2D(region)
+			, detail::ScopedIframeStackEntry(region)
+			, s3d::Transformer2D(Mat3x2::Identity(), Transformer2D::Target::SetLocal)
+			, s3d::ScopedRenderStates2D(PremultipliedAccumulation(), RasterizerState::Default2D)
+		{
+			const ScopedRenderStates2D opaque{BlendState::Opaque};
+			Rect{region.size}.draw(ColorF{0.0, 0.0});
+		}
+
+	private:
+		// 透明な描画先に重ねていくと、アルファ乗算済みの結果になる
+		static BlendState PremultipliedAccumulation() noexcept
+		{
+			return BlendState{true, Blend::SrcAlpha, Blend::InvSrcAlpha, BlendOp::Add, Blend::One, Blend::InvSrcAlpha, BlendOp::Add};
+		}
+	};
+
 	struct Iframe
 	{
 		static Rect RectAtScene() noexcept
 		{
-			return Graphics2D::GetViewport().value_or(Scene::Rect());
+			return detail::IframeStack::Top();
 		}
 
 		static Point Size() noexcept
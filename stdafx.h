@@ -5,5 +5,4 @@
 #include "CurryGenerator.hpp"
 #include "ExpressionFunctor.hpp"
 #include "GraphemeView.hpp"
-#include "LerpTransition.hpp"
 #include "UnicodeProperty.hpp"